@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2021 Emanuel Machado da Silva
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Counts how many heap allocations the Maths runners make with pzl::Integer and pzl::Rational, by replacing the
+// global operator new, e.g.: make bench_allocations
+
+#include "common/numbers/integer.h"
+#include "common/numbers/montgomery.h"
+#include "common/numbers/rational.h"
+#include "maths/expressions.h"
+#include "maths/josephus/solver.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <string>
+
+using pzl::Integer;
+using pzl::Rational;
+
+using std::cout;
+
+namespace {
+size_t allocations = 0;
+}
+
+void *operator new(size_t size) {
+  ++allocations;
+  auto *pointer = std::malloc(size == 0 ? 1 : size);
+  if (pointer == nullptr) std::abort(); // We're built without exceptions, so there's no std::bad_alloc
+  return pointer;
+}
+
+void operator delete(void *pointer) noexcept {
+  std::free(pointer);
+}
+
+void operator delete(void *pointer, size_t) noexcept {
+  std::free(pointer);
+}
+
+// Returns how many allocations `function` made
+template <typename Function>
+size_t countAllocations(const Function &function) {
+  auto before = allocations;
+  function();
+  return allocations - before;
+}
+
+void report(const std::string &name, size_t count) {
+  cout << "  " << std::left << std::setw(48) << name << std::right << std::setw(10) << count << "\n";
+}
+
+int main() {
+  // Same inputs as the Maths runner
+  constexpr intmax_t circleSize = 139562;
+  const std::string expression = "3+(4*2)^2^3/(1-5)^2";
+
+  cout << "Heap allocations:\n";
+
+  Integer circle{circleSize};
+  report("Josephus, arithmetic solver",
+         countAllocations([&circle] { return Maths::Josephus::ArithmeticSolver::solve(circle) == 16981; }));
+
+  // Every item in the circle is a std::shared_ptr, so that many allocations are unavoidable
+  auto simulation = countAllocations([&circle] { return Maths::Josephus::SimulationSolver::solve(circle) == 16981; });
+  report("Josephus, simulation solver (besides the circle)", simulation - static_cast<size_t>(circleSize));
+
+  // The same operations the evaluator ends up doing, in the same order, but without its token list and stacks
+  report("Expression, arithmetic only", countAllocations([] {
+           auto power = std::pow(Rational(4) * Rational(2), std::pow(Rational(2), Rational(3)));
+           auto result = Rational(3) + power / std::pow(Rational(1) - Rational(5), Rational(2));
+           return result == 1048579;
+         }));
+  report("Expression, including the parser",
+         countAllocations([&expression] { return Maths::evaluateExpression(expression) == 1048579; }));
+
+  report("Comparisons and additions with intmax_t", countAllocations([&circle] {
+           size_t matches = 0;
+           for (intmax_t i = 0; i < 1000; ++i) {
+             if (circle + i > i && circle - i != i && circle * i > i - 1) ++matches;
+           }
+           return matches;
+         }));
+
+  // Parsing the moduli allocates for the strings, so that happens outside
+  Integer prime64{"18446744073709551557"};
+  Integer prime128{"170141183460469231731687303715884105727"};
+  report("Montgomery contexts of 64 and 128 bits", countAllocations([&prime64, &prime128] {
+           pzl::MontgomeryContext64 context64{prime64};
+           pzl::MontgomeryContext128 context128{prime128};
+           Integer exponent{1000000};
+           return context64.powMod(Integer{3}, exponent) != 0 && context128.powMod(Integer{5}, exponent) != 0;
+         }));
+
+  return 0;
+}
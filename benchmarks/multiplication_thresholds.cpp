@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2026 Emanuel Machado da Silva
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Finds the operand sizes where each pzl::Integer multiplication algorithm starts beating the previous one on this
+// machine, so they can be used as PZL_KARATSUBA_THRESHOLD, PZL_TOOM_COOK_3_THRESHOLD and PZL_NTT_THRESHOLD
+// Should be run on a Release build, e.g.: make bench
+
+#include "common/numbers/integer_kernels.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+
+using pzl::kernels::SlicesView;
+using pzl::kernels::value_t;
+
+using std::cout;
+
+using multiplication = std::function<void(SlicesView, SlicesView, value_t *)>;
+
+std::vector<value_t> randomSlices(size_t size, std::mt19937 *engine) {
+  std::uniform_int_distribution<value_t> distribution{0, pzl::kernels::SLICE_MAX};
+
+  std::vector<value_t> result(size);
+  for (auto &slice : result) {
+    slice = distribution(*engine);
+  }
+  result.back() |= 1; // Don't let it be trimmed
+
+  return result;
+}
+
+// Returns how many nanoseconds a single multiplication takes, on average
+double measure(const multiplication &function, size_t size, std::mt19937 *engine) {
+  auto left = randomSlices(size, engine);
+  auto right = randomSlices(size, engine);
+  std::vector<value_t> out(size * 2);
+
+  constexpr auto minimumDuration = std::chrono::milliseconds(50);
+  size_t iterations = 0;
+  auto start = std::chrono::steady_clock::now();
+  auto elapsed = std::chrono::steady_clock::duration::zero();
+  do {
+    function(left, right, out.data());
+    ++iterations;
+    elapsed = std::chrono::steady_clock::now() - start;
+  } while (elapsed < minimumDuration);
+
+  return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) /
+         static_cast<double>(iterations);
+}
+
+// Returns the first size from which `faster` beats `slower` on two sizes in a row
+size_t findCrossover(const std::string &name, const std::vector<size_t> &sizes, const multiplication &slower,
+                     const multiplication &faster, const std::function<void(size_t)> &prepare) {
+  std::mt19937 engine{42};
+
+  cout << name << ":\n";
+  size_t candidate = 0;
+  for (auto size : sizes) {
+    prepare(size);
+    auto slowerTime = measure(slower, size, &engine);
+    auto fasterTime = measure(faster, size, &engine);
+    cout << "  " << std::setw(6) << size << " slices: " << std::setw(14) << std::fixed << std::setprecision(0)
+         << slowerTime << " ns vs " << std::setw(14) << fasterTime << " ns\n";
+
+    if (fasterTime < slowerTime) {
+      if (candidate != 0) return candidate;
+      candidate = size;
+    } else {
+      candidate = 0;
+    }
+  }
+
+  return candidate != 0 ? candidate : sizes.back();
+}
+
+int main() {
+  auto &thresholds = pzl::kernels::multiplicationThresholds;
+  constexpr auto never = std::numeric_limits<size_t>::max();
+
+  // Each candidate only gets to use its own algorithm on the top level, everything below that uses the lower tiers
+  auto karatsuba = findCrossover(
+      "Schoolbook vs Karatsuba", {8, 12, 16, 20, 24, 32, 40, 48, 64, 80, 96, 128, 160, 192, 256},
+      pzl::kernels::multiplySchoolbook, pzl::kernels::multiplyKaratsuba, [&thresholds](size_t size) {
+        thresholds.karatsuba = size;
+        thresholds.toomCook3 = never;
+        thresholds.numberTheoretic = never;
+      });
+
+  auto toomCook3 = findCrossover(
+      "Karatsuba vs Toom-Cook 3", {48, 64, 80, 96, 128, 160, 192, 256, 320, 384, 512, 640, 768, 1024, 1536, 2048},
+      pzl::kernels::multiplyKaratsuba, pzl::kernels::multiplyToomCook3, [&thresholds, karatsuba](size_t size) {
+        thresholds.karatsuba = karatsuba;
+        thresholds.toomCook3 = size;
+        thresholds.numberTheoretic = never;
+      });
+
+  auto numberTheoretic = findCrossover(
+      "Toom-Cook 3 vs NTT", {1024, 2048, 4096, 8192, 16384, 32768, 65536, 131072, 262144},
+      pzl::kernels::multiplyToomCook3, pzl::kernels::multiplyNumberTheoretic,
+      [&thresholds, karatsuba, toomCook3](size_t size) {
+        thresholds.karatsuba = karatsuba;
+        thresholds.toomCook3 = std::min(toomCook3, size);
+        thresholds.numberTheoretic = size;
+      });
+
+  cout << "\nSuggested thresholds for this machine:\n"
+       << "  cmake -DPZL_KARATSUBA_THRESHOLD=" << karatsuba << " -DPZL_TOOM_COOK_3_THRESHOLD=" << toomCook3
+       << " -DPZL_NTT_THRESHOLD=" << numberTheoretic << "\n";
+
+  return 0;
+}
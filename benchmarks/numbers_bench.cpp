@@ -0,0 +1,294 @@
+/*
+ * Copyright (c) 2026 Emanuel Machado da Silva
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Times pzl::Integer and pzl::Rational operations over operand sizes from 1 up to 10^6 slices, so algorithmic
+// regressions show up, and so the multiplication and division thresholds can be picked with real numbers
+// The results are printed as JSON, in the same layout Google Benchmark uses, so its tools/compare.py can diff two runs
+// Should be run on a Release build, e.g.: make bench_numbers > before.json
+// Takes --filter=<substring>, to only run some of them, and --max-slices=<size>, to stop early
+
+#include "common/numbers/integer.h"
+#include "common/numbers/integers.h"
+#include "common/numbers/rational.h"
+
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using pzl::Integer;
+using pzl::Rational;
+
+using std::cout;
+
+namespace {
+
+constexpr size_t SLICE_BYTES = sizeof(Integer::value_t);
+
+// Every operation goes as far up this list as its cap allows
+const std::vector<size_t> sizes{1, 4, 16, 64, 256, 1024, 4096, 16384, 65536, 262144, 1000000};
+
+struct Result {
+  std::string name;
+  size_t iterations;
+  double realNanoseconds; // Per operation
+  double cpuNanoseconds;
+  double bytesPerSecond;
+};
+
+// Keeps the compiler from throwing away results nobody looks at
+template <typename T>
+inline void keep(const T &value) {
+  asm volatile("" : : "g"(&value) : "memory");
+}
+
+// Random positive Integers of exactly `size` slices, built in halves, so it doesn't take quadratic time
+Integer randomInteger(size_t size, std::mt19937_64 *engine) {
+  if (size <= 2) {
+    std::uniform_int_distribution<intmax_t> distribution{1, size == 1 ? INTMAX_C(0xFFFFFFFF) : INTMAX_MAX};
+    auto result = Integer{distribution(*engine)};
+    return size == 1 ? result : result | (Integer{1} << 62);
+  }
+
+  auto high = randomInteger(size - size / 2, engine);
+  auto low = randomInteger(size / 2, engine);
+  return (high << (32 * (size / 2))) + low;
+}
+
+// Runs `operation` over and over for a while, `bytes` is how much input each run goes through
+template <typename Operation>
+Result measure(const std::string &name, size_t bytes, const Operation &operation) {
+  constexpr auto minimumDuration = std::chrono::milliseconds(50);
+
+  keep(operation()); // Warms up the caches, and the allocator
+
+  size_t iterations = 0;
+  auto cpuStart = std::clock();
+  auto start = std::chrono::steady_clock::now();
+  auto elapsed = std::chrono::steady_clock::duration::zero();
+  do {
+    keep(operation());
+    ++iterations;
+    elapsed = std::chrono::steady_clock::now() - start;
+  } while (elapsed < minimumDuration);
+  auto cpuElapsed = static_cast<double>(std::clock() - cpuStart) / CLOCKS_PER_SEC;
+
+  auto realNanoseconds = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) /
+                         static_cast<double>(iterations);
+  return Result{name, iterations, realNanoseconds, cpuElapsed * 1e9 / static_cast<double>(iterations),
+                static_cast<double>(bytes) * 1e9 / realNanoseconds};
+}
+
+struct Benchmark {
+  std::string name;
+  size_t maxSize; // The quadratic ones would take minutes at the top sizes
+  // Sets up the operands for the given size, and returns the operation along with how many bytes of input it reads
+  std::function<std::pair<std::function<Integer()>, size_t>(size_t, std::mt19937_64 *)> prepare;
+};
+
+// Rationals don't expose much besides their text, so these report the size of the result instead
+struct RationalBenchmark {
+  std::string name;
+  size_t maxSize;
+  std::function<std::pair<std::function<Rational()>, size_t>(size_t, std::mt19937_64 *)> prepare;
+};
+
+// Two operands of the same size, as most of them take
+template <typename Function>
+auto binary(Function function) {
+  return [function](size_t size, std::mt19937_64 *engine) {
+    auto left = randomInteger(size, engine);
+    auto right = randomInteger(size, engine);
+    return std::pair{std::function<Integer()>{[function, left, right] { return function(left, right); }},
+                     2 * size * SLICE_BYTES};
+  };
+}
+
+// Numbers of `size` slices, with (probably) no common factors, so nothing simplifies away
+Rational randomRational(size_t size, std::mt19937_64 *engine) {
+  return Rational{randomInteger(size, engine), randomInteger(size, engine) | Integer{1}};
+}
+
+template <typename Function>
+auto binaryRational(Function function) {
+  return [function](size_t size, std::mt19937_64 *engine) {
+    auto left = randomRational(size, engine);
+    auto right = randomRational(size, engine);
+    return std::pair{std::function<Rational()>{[function, left, right] { return function(left, right); }},
+                     4 * size * SLICE_BYTES};
+  };
+}
+
+// The exponent that takes 3 to about `size` slices
+Integer exponentFor(size_t size) {
+  return Integer{static_cast<intmax_t>(static_cast<double>(size) * 32 / 1.5849625007211562)}; // log2(3)
+}
+
+const std::vector<Benchmark> integerBenchmarks{
+    {"add", 1000000, binary([](const Integer &left, const Integer &right) { return left + right; })},
+    {"subtract", 1000000, binary([](const Integer &left, const Integer &right) { return left - right; })},
+    {"multiply", 1000000, binary([](const Integer &left, const Integer &right) { return left * right; })},
+    // These divide twice the size by the size, which is where both long division and the reciprocal work hardest
+    {"divide", 262144,
+     [](size_t size, std::mt19937_64 *engine) {
+       auto dividend = randomInteger(2 * size, engine);
+       auto divisor = randomInteger(size, engine);
+       return std::pair{std::function<Integer()>{[dividend, divisor] { return dividend / divisor; }},
+                        3 * size * SLICE_BYTES};
+     }},
+    {"modulo", 262144,
+     [](size_t size, std::mt19937_64 *engine) {
+       auto dividend = randomInteger(2 * size, engine);
+       auto divisor = randomInteger(size, engine);
+       return std::pair{std::function<Integer()>{[dividend, divisor] { return dividend % divisor; }},
+                        3 * size * SLICE_BYTES};
+     }},
+    {"power", 1000000,
+     [](size_t size, std::mt19937_64 *) {
+       auto exponent = exponentFor(size);
+       return std::pair{std::function<Integer()>{[exponent] { return Integer{3}.power(exponent); }},
+                        size * SLICE_BYTES};
+     }},
+    {"gcd", 16384, binary([](const Integer &left, const Integer &right) {
+       return pzl::greatestCommonDivisor(left, right);
+     })},
+    {"parse", 65536,
+     [](size_t size, std::mt19937_64 *engine) {
+       auto digits = randomInteger(size, engine).toString();
+       return std::pair{std::function<Integer()>{[digits] { return Integer{digits}; }}, digits.size()};
+     }},
+    // Handing the length back as an Integer is cheap next to the conversion itself
+    {"toString", 65536,
+     [](size_t size, std::mt19937_64 *engine) {
+       auto value = randomInteger(size, engine);
+       return std::pair{std::function<Integer()>{[value] {
+                          return Integer{static_cast<intmax_t>(value.toString().size())};
+                        }},
+                        size * SLICE_BYTES};
+     }},
+};
+
+// Every Rational operation simplifies its result, so these are all as slow as gcd
+const std::vector<RationalBenchmark> rationalBenchmarks{
+    {"add", 4096, binaryRational([](const Rational &left, const Rational &right) { return left + right; })},
+    {"subtract", 4096, binaryRational([](const Rational &left, const Rational &right) { return left - right; })},
+    {"multiply", 4096, binaryRational([](const Rational &left, const Rational &right) { return left * right; })},
+    // Only whole numbers can be divided for now
+    {"divide", 16384,
+     [](size_t size, std::mt19937_64 *engine) {
+       auto dividend = Rational{randomInteger(2 * size, engine)};
+       auto divisor = Rational{randomInteger(size, engine)};
+       return std::pair{std::function<Rational()>{[dividend, divisor] { return dividend / divisor; }},
+                        3 * size * SLICE_BYTES};
+     }},
+    {"power", 65536,
+     [](size_t size, std::mt19937_64 *) {
+       auto exponent = Rational{exponentFor(size)};
+       return std::pair{std::function<Rational()>{[exponent] { return Rational{3, 2}.power(exponent); }},
+                        size * SLICE_BYTES};
+     }},
+    {"parse", 65536,
+     [](size_t size, std::mt19937_64 *engine) {
+       auto digits = randomInteger(size, engine).toString();
+       return std::pair{std::function<Rational()>{[digits] { return Rational{digits}; }}, digits.size()};
+     }},
+    {"toString", 16384,
+     [](size_t size, std::mt19937_64 *engine) {
+       auto value = randomRational(size, engine);
+       return std::pair{std::function<Rational()>{[value] {
+                          return Rational{static_cast<intmax_t>(value.toString().size())};
+                        }},
+                        2 * size * SLICE_BYTES};
+     }},
+};
+
+void printJson(const std::vector<Result> &results) {
+  cout << "{\n"
+       << "  \"context\": {\n"
+       << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n"
+#ifdef NDEBUG
+       << "    \"library_build_type\": \"release\"\n"
+#else
+       << "    \"library_build_type\": \"debug\"\n"
+#endif
+       << "  },\n"
+       << "  \"benchmarks\": [";
+
+  cout << std::fixed << std::setprecision(1);
+  for (size_t i = 0; i < results.size(); ++i) {
+    const auto &result = results[i];
+    cout << (i == 0 ? "\n" : ",\n") << "    {\n"
+         << "      \"name\": \"" << result.name << "\",\n"
+         << "      \"run_name\": \"" << result.name << "\",\n"
+         << "      \"run_type\": \"iteration\",\n"
+         << "      \"iterations\": " << result.iterations << ",\n"
+         << "      \"real_time\": " << result.realNanoseconds << ",\n"
+         << "      \"cpu_time\": " << result.cpuNanoseconds << ",\n"
+         << "      \"time_unit\": \"ns\",\n"
+         << "      \"bytes_per_second\": " << result.bytesPerSecond << "\n"
+         << "    }";
+  }
+  cout << "\n  ]\n}\n";
+}
+}
+
+int main(int argc, char **argv) {
+  std::string filter;
+  size_t maxSize = sizes.back();
+  for (auto i = 1; i < argc; ++i) {
+    std::string argument{argv[i]};
+    if (argument.rfind("--filter=", 0) == 0) {
+      filter = argument.substr(9);
+    } else if (argument.rfind("--max-slices=", 0) == 0) {
+      maxSize = std::stoul(argument.substr(13));
+    } else {
+      std::cerr << "Usage: " << argv[0] << " [--filter=<substring>] [--max-slices=<size>]\n";
+      return 1;
+    }
+  }
+
+  std::vector<Result> results;
+  auto run = [&results, &filter, maxSize](const std::string &type, const auto &benchmarks) {
+    for (const auto &benchmark : benchmarks) {
+      std::mt19937_64 engine{42};
+      for (auto size : sizes) {
+        auto name = type + "/" + benchmark.name + "/" + std::to_string(size);
+        if (size > benchmark.maxSize || size > maxSize || name.find(filter) == std::string::npos) continue;
+
+        std::cerr << name << "\n"; // Some of them take a while, so there's something to look at
+        auto [operation, bytes] = benchmark.prepare(size, &engine);
+        results.push_back(measure(name, bytes, operation));
+      }
+    }
+  };
+  run("Integer", integerBenchmarks);
+  run("Rational", rationalBenchmarks);
+
+  printJson(results);
+  return 0;
+}
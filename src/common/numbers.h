@@ -39,7 +39,9 @@ constexpr char itoc(uint8_t i) {
   return static_cast<char>(i + '0');
 }
 
+// Anything past 20! doesn't fit, pzl::factorial has no such limit
 constexpr uintmax_t factorial(uintmax_t value) {
+  ensure(value <= 20);
   return (value < 2) ? 1 : value * factorial(value - 1);
 }
 
@@ -0,0 +1,447 @@
+/*
+ * Copyright (c) 2026 Emanuel Machado da Silva
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "common/assertions.h" // ensure, UNUSED
+#include "common/numbers/integer.h"
+#include "compat/compare.h" // compat::strong_ordering
+
+#include <algorithm> // std::copy, std::fill, std::max
+#include <array>     // std::array
+#include <bit>       // std::bit_width, std::countr_zero, std::popcount
+#include <cstddef>   // size_t
+#include <cstdint>   // uint64_t, intmax_t
+#include <limits>    // std::numeric_limits
+#include <optional>  // std::optional, std::nullopt
+#include <string>    // std::string
+#include <utility>   // std::pair
+
+namespace pzl {
+
+namespace detail {
+// Long division straight on slices, see fixed_integer.cpp; `divisor` must be trimmed and no longer than `dividend`,
+// `quotient` needs room for dividendSize - divisorSize + 1 slices, and `remainder` for divisorSize slices
+void divideSlices(const Integer::value_t *dividend, size_t dividendSize, const Integer::value_t *divisor,
+                  size_t divisorSize, Integer::value_t *quotient, Integer::value_t *remainder);
+}
+
+// An Integer for values that are known to stay below 2^Bits in magnitude, which keeps its slices in an std::array, so
+// it never touches the heap, and every loop has a fixed length that the compiler can unroll
+// Results that don't fit are only caught by ensure, so in Release builds the operators, the intmax_t constructor and
+// power() are undefined on overflow; when that's a possibility, the try* methods check it in every build type, leaving
+// the value alone, so the caller can carry on with toInteger()
+template <size_t Bits>
+struct FixedInteger {
+  using value_t = Integer::value_t;
+
+  static constexpr size_t SLICE_BITS = std::numeric_limits<value_t>::digits;
+  static constexpr size_t SLICE_COUNT = Bits / SLICE_BITS;
+  static_assert(Bits > 0 && Bits % SLICE_BITS == 0, "FixedIntegers are made of whole slices");
+
+  using slices_t = std::array<value_t, SLICE_COUNT>;
+
+  constexpr explicit FixedInteger(intmax_t value) : _positive(value >= 0) {
+    auto magnitude = static_cast<uintmax_t>(value);
+    if (value < 0) magnitude = 0 - magnitude;
+
+    for (size_t i = 0; i < SLICE_COUNT && magnitude > 0; ++i) {
+      slices[i] = static_cast<value_t>(magnitude);
+      magnitude = SLICE_BITS < std::numeric_limits<uintmax_t>::digits ? magnitude >> SLICE_BITS : 0;
+    }
+    ensure(magnitude == 0); // Doesn't fit
+  }
+
+  // Empty when the value doesn't fit, so it never writes past the slices, whatever the build type
+  [[nodiscard]] static std::optional<FixedInteger> from(const Integer &value) {
+    if (!fits(value)) return std::nullopt;
+
+    slices_t slices{};
+    std::copy(value.slices.begin(), value.slices.end(), slices.begin());
+    return FixedInteger{slices, value._positive};
+  }
+
+  [[nodiscard]] static inline bool fits(const Integer &value) { return value.slices.size() <= SLICE_COUNT; }
+
+  [[nodiscard]] Integer toInteger() const {
+    auto size = trimmedSize(slices);
+    return Integer{Integer::slices_t{slices.data(), slices.data() + size}, _positive};
+  }
+
+  [[nodiscard]] inline constexpr FixedInteger absolute() const { return FixedInteger{slices, true}; }
+  [[nodiscard]] inline constexpr bool positive() const { return _positive; }
+  [[nodiscard]] inline std::string toString() const { return toInteger().toString(); }
+
+  [[nodiscard]] inline constexpr FixedInteger operator-() const { return FixedInteger{slices, !_positive}; }
+
+  // These leave the value untouched and return false when the result doesn't fit
+  [[nodiscard]] constexpr bool tryAdd(const FixedInteger &o) { return tryAddSigned(o.slices, o._positive); }
+  [[nodiscard]] constexpr bool trySubtract(const FixedInteger &o) { return tryAddSigned(o.slices, !o._positive); }
+  [[nodiscard]] constexpr bool tryMultiply(const FixedInteger &o) {
+    slices_t product{};
+    if (!multiplyMagnitudes(slices, o.slices, &product)) return false;
+
+    slices = product;
+    _positive = _positive == o._positive || isZero();
+    return true;
+  }
+
+  [[nodiscard]] inline constexpr FixedInteger operator+(const FixedInteger &o) const {
+    auto result = *this;
+    result += o;
+    return result;
+  }
+
+  [[nodiscard]] inline constexpr FixedInteger operator-(const FixedInteger &o) const {
+    auto result = *this;
+    result -= o;
+    return result;
+  }
+
+  [[nodiscard]] inline constexpr FixedInteger operator*(const FixedInteger &o) const {
+    auto result = *this;
+    result *= o;
+    return result;
+  }
+
+  [[nodiscard]] inline FixedInteger operator/(const FixedInteger &o) const { return divmod(o).first; }
+  [[nodiscard]] inline FixedInteger operator%(const FixedInteger &o) const { return divmod(o).second; }
+
+  // Truncated division, the same as Integer::divmod
+  [[nodiscard]] std::pair<FixedInteger, FixedInteger> divmod(const FixedInteger &o) const {
+    ensure(!o.isZero()); // division by zero is undefined
+
+    std::pair<FixedInteger, FixedInteger> result{FixedInteger{0}, *this};
+    auto dividendSize = trimmedSize(slices);
+    auto divisorSize = trimmedSize(o.slices);
+    if (dividendSize < divisorSize) return result;
+
+    result.first._positive = _positive == o._positive;
+    detail::divideSlices(slices.data(), dividendSize, o.slices.data(), divisorSize, result.first.slices.data(),
+                         result.second.slices.data());
+    std::fill(result.second.slices.begin() + static_cast<std::ptrdiff_t>(divisorSize), result.second.slices.end(), 0);
+
+    result.first._positive = result.first._positive || result.first.isZero();
+    result.second._positive = result.second._positive || result.second.isZero();
+    return result;
+  }
+
+  [[nodiscard]] inline constexpr FixedInteger operator+(intmax_t o) const { return *this + FixedInteger{o}; }
+  [[nodiscard]] inline constexpr FixedInteger operator-(intmax_t o) const { return *this - FixedInteger{o}; }
+  [[nodiscard]] inline constexpr FixedInteger operator*(intmax_t o) const { return *this * FixedInteger{o}; }
+
+  // These look at the magnitude alone, so they ignore the sign; countTrailingZeros is undefined for zero
+  [[nodiscard]] constexpr size_t bitLength() const {
+    auto size = trimmedSize(slices);
+    return size == 0 ? 0 : (size - 1) * SLICE_BITS + static_cast<size_t>(std::bit_width(slices[size - 1]));
+  }
+
+  [[nodiscard]] constexpr size_t countTrailingZeros() const {
+    ensure(!isZero()); // Zero doesn't have any set bits to count up to
+
+    size_t i = 0;
+    while (slices[i] == 0) {
+      ++i;
+    }
+    return i * SLICE_BITS + static_cast<size_t>(std::countr_zero(slices[i]));
+  }
+
+  [[nodiscard]] constexpr size_t popCount() const {
+    size_t count = 0;
+    for (auto slice : slices) {
+      count += static_cast<size_t>(std::popcount(slice));
+    }
+    return count;
+  }
+
+  // Shifting right rounds towards negative infinity, the same as Integer does
+  [[nodiscard]] inline constexpr FixedInteger operator<<(size_t bits) const {
+    auto result = *this;
+    result <<= bits;
+    return result;
+  }
+
+  [[nodiscard]] inline constexpr FixedInteger operator>>(size_t bits) const {
+    auto result = *this;
+    result >>= bits;
+    return result;
+  }
+
+  [[nodiscard]] constexpr FixedInteger power(const FixedInteger &exponent) const {
+    auto result = *this;
+    auto fits = result.tryPower(exponent);
+    ensure(fits);
+    UNUSED(fits);
+    return result;
+  }
+
+  // Raises this to `exponent` in place, the same as power
+  [[nodiscard]] constexpr bool tryPower(const FixedInteger &exponent) {
+    ensure(!isZero() || !exponent.isZero()); // zero ^ zero is undefined
+    ensure(exponent.positive());             // Haven't implemented this yet
+
+    FixedInteger result{1};
+    for (auto bit = exponent.bitLength(); bit-- > 0;) {
+      if (!result.tryMultiply(result)) return false;
+      auto bitIsSet = (exponent.slices[bit / SLICE_BITS] >> (bit % SLICE_BITS)) & 1;
+      if (bitIsSet && !result.tryMultiply(*this)) return false;
+    }
+    *this = result;
+    return true;
+  }
+
+  [[nodiscard]] inline constexpr bool operator==(const FixedInteger &o) const {
+    return _positive == o._positive && slices == o.slices;
+  }
+  [[nodiscard]] inline constexpr bool operator!=(const FixedInteger &o) const { return !(*this == o); }
+
+  [[nodiscard]] constexpr compat::strong_ordering compareTo(const FixedInteger &o) const {
+    if (_positive != o._positive) {
+      return _positive ? compat::strong_ordering::greater : compat::strong_ordering::less;
+    }
+
+    auto comparison = compareMagnitudes(slices, o.slices);
+    if (_positive || comparison == compat::strong_ordering::equal) return comparison;
+    return comparison == compat::strong_ordering::less ? compat::strong_ordering::greater
+                                                       : compat::strong_ordering::less;
+  }
+  // Scalars don't have to fit in Bits, so this compares against the magnitude instead of making a FixedInteger of it
+  [[nodiscard]] constexpr compat::strong_ordering compareTo(intmax_t o) const {
+    if (_positive != (o >= 0)) {
+      return _positive ? compat::strong_ordering::greater : compat::strong_ordering::less;
+    }
+
+    auto comparison = compareMagnitudeToScalar(slices, Integer::magnitudeOf(o));
+    return _positive ? comparison : Integer::reversed(comparison);
+  }
+
+  [[nodiscard]] inline constexpr bool operator==(intmax_t o) const {
+    return compareTo(o) == compat::strong_ordering::equal;
+  }
+  [[nodiscard]] inline constexpr bool operator!=(intmax_t o) const {
+    return compareTo(o) != compat::strong_ordering::equal;
+  }
+
+#ifdef __cpp_lib_three_way_comparison
+  [[nodiscard]] inline constexpr std::strong_ordering operator<=>(const FixedInteger &o) const { return compareTo(o); }
+  [[nodiscard]] inline constexpr std::strong_ordering operator<=>(intmax_t o) const { return compareTo(o); }
+#else
+  [[nodiscard]] inline constexpr bool operator<(const FixedInteger &o) const {
+    return compareTo(o) == compat::strong_ordering::less;
+  }
+  [[nodiscard]] inline constexpr bool operator<=(const FixedInteger &o) const {
+    return compareTo(o) != compat::strong_ordering::greater;
+  }
+  [[nodiscard]] inline constexpr bool operator>(const FixedInteger &o) const {
+    return compareTo(o) == compat::strong_ordering::greater;
+  }
+  [[nodiscard]] inline constexpr bool operator>=(const FixedInteger &o) const {
+    return compareTo(o) != compat::strong_ordering::less;
+  }
+
+  [[nodiscard]] inline constexpr bool operator<(intmax_t o) const {
+    return compareTo(o) == compat::strong_ordering::less;
+  }
+  [[nodiscard]] inline constexpr bool operator<=(intmax_t o) const {
+    return compareTo(o) != compat::strong_ordering::greater;
+  }
+  [[nodiscard]] inline constexpr bool operator>(intmax_t o) const {
+    return compareTo(o) == compat::strong_ordering::greater;
+  }
+  [[nodiscard]] inline constexpr bool operator>=(intmax_t o) const {
+    return compareTo(o) != compat::strong_ordering::less;
+  }
+#endif
+
+  inline constexpr FixedInteger &operator++() {
+    *this += 1;
+    return *this;
+  }
+
+  inline constexpr void operator+=(const FixedInteger &o) {
+    auto fits = tryAdd(o);
+    ensure(fits);
+    UNUSED(fits);
+  }
+
+  inline constexpr void operator-=(const FixedInteger &o) {
+    auto fits = trySubtract(o);
+    ensure(fits);
+    UNUSED(fits);
+  }
+
+  inline constexpr void operator*=(const FixedInteger &o) {
+    auto fits = tryMultiply(o);
+    ensure(fits);
+    UNUSED(fits);
+  }
+
+  inline void operator/=(const FixedInteger &o) { *this = divmod(o).first; }
+  inline void operator%=(const FixedInteger &o) { *this = divmod(o).second; }
+
+  constexpr void operator<<=(size_t bits) {
+    ensure(isZero() || bitLength() + bits <= Bits); // Doesn't fit
+
+    auto offset = bits / SLICE_BITS;
+    auto shift = bits % SLICE_BITS;
+    for (auto i = SLICE_COUNT; i-- > 0;) {
+      value_t slice = 0;
+      if (i >= offset) {
+        slice = slices[i - offset] << shift;
+        if (shift > 0 && i > offset) slice |= slices[i - offset - 1] >> (SLICE_BITS - shift);
+      }
+      slices[i] = slice;
+    }
+  }
+
+  constexpr void operator>>=(size_t bits) {
+    // Rounding a negative number down means rounding its magnitude up, whenever any of the bits we drop were set
+    auto roundUp = !_positive && countTrailingZeros() < bits;
+
+    auto offset = bits / SLICE_BITS;
+    auto shift = bits % SLICE_BITS;
+    for (size_t i = 0; i < SLICE_COUNT; ++i) {
+      value_t slice = 0;
+      if (i + offset < SLICE_COUNT) {
+        slice = slices[i + offset] >> shift;
+        if (shift > 0 && i + offset + 1 < SLICE_COUNT) slice |= slices[i + offset + 1] << (SLICE_BITS - shift);
+      }
+      slices[i] = slice;
+    }
+
+    // The shift dropped at least one bit, so there's always room for the magnitude to grow by one
+    if (roundUp) {
+      auto fits = trySubtract(FixedInteger{1});
+      UNUSED(fits);
+    }
+    _positive = _positive || isZero();
+  }
+
+  inline constexpr void operator+=(intmax_t o) { *this += FixedInteger{o}; }
+  inline constexpr void operator-=(intmax_t o) { *this -= FixedInteger{o}; }
+  inline constexpr void operator*=(intmax_t o) { *this *= FixedInteger{o}; }
+
+private:
+  slices_t slices{}; // Low-endian, always all of them, padded with zeroes
+  bool _positive;
+
+  constexpr FixedInteger(const slices_t &slices, bool positive) : slices(slices), _positive(positive) {
+    _positive = _positive || isZero();
+  }
+
+  [[nodiscard]] constexpr bool isZero() const {
+    for (auto slice : slices) {
+      if (slice != 0) return false;
+    }
+    return true;
+  }
+
+  [[nodiscard]] static constexpr size_t trimmedSize(const slices_t &slices) {
+    auto size = SLICE_COUNT;
+    while (size > 0 && slices[size - 1] == 0) {
+      --size;
+    }
+    return size;
+  }
+
+  [[nodiscard]] static constexpr compat::strong_ordering compareMagnitudes(const slices_t &left,
+                                                                          const slices_t &right) {
+    for (auto i = SLICE_COUNT; i-- > 0;) {
+      if (left[i] != right[i]) {
+        return left[i] < right[i] ? compat::strong_ordering::less : compat::strong_ordering::greater;
+      }
+    }
+    return compat::strong_ordering::equal;
+  }
+
+  [[nodiscard]] static constexpr compat::strong_ordering compareMagnitudeToScalar(const slices_t &slices,
+                                                                                  uintmax_t magnitude) {
+    constexpr size_t SCALAR_SLICES = std::numeric_limits<uintmax_t>::digits / SLICE_BITS;
+    for (auto i = std::max(SLICE_COUNT, SCALAR_SLICES); i-- > 0;) {
+      value_t left = i < SLICE_COUNT ? slices[i] : 0;
+      value_t right = i < SCALAR_SLICES ? static_cast<value_t>(magnitude >> (i * SLICE_BITS)) : 0;
+      if (left != right) return left < right ? compat::strong_ordering::less : compat::strong_ordering::greater;
+    }
+    return compat::strong_ordering::equal;
+  }
+
+  [[nodiscard]] constexpr bool tryAddSigned(const slices_t &other, bool otherPositive) {
+    if (_positive == otherPositive) {
+      slices_t sum{};
+      uint64_t carry = 0;
+      for (size_t i = 0; i < SLICE_COUNT; ++i) {
+        carry += uint64_t{slices[i]} + other[i];
+        sum[i] = static_cast<value_t>(carry);
+        carry >>= SLICE_BITS;
+      }
+      if (carry != 0) return false;
+
+      slices = sum;
+      return true;
+    }
+
+    // Opposite signs can't overflow, it's the smaller magnitude coming out of the bigger one
+    auto otherIsBigger = compareMagnitudes(slices, other) == compat::strong_ordering::less;
+    const auto bigger = otherIsBigger ? other : slices;
+    const auto &smaller = otherIsBigger ? slices : other;
+
+    uint64_t borrow = 0;
+    for (size_t i = 0; i < SLICE_COUNT; ++i) {
+      auto subtrahend = uint64_t{smaller[i]} + borrow;
+      borrow = bigger[i] < subtrahend ? 1 : 0;
+      slices[i] = static_cast<value_t>(bigger[i] - subtrahend);
+    }
+    if (otherIsBigger) _positive = otherPositive;
+    _positive = _positive || isZero();
+    return true;
+  }
+
+  // Returns false if the product doesn't fit, leaving `out` in pieces
+  [[nodiscard]] static constexpr bool multiplyMagnitudes(const slices_t &left, const slices_t &right, slices_t *out) {
+    for (size_t i = 0; i < SLICE_COUNT; ++i) {
+      if (left[i] == 0) continue;
+
+      uint64_t carry = 0;
+      for (size_t j = 0; i + j < SLICE_COUNT; ++j) {
+        carry += uint64_t{left[i]} * right[j] + (*out)[i + j];
+        (*out)[i + j] = static_cast<value_t>(carry);
+        carry >>= SLICE_BITS;
+      }
+      if (carry != 0) return false;
+
+      // Whatever's left of `right` would land past the top slice
+      for (auto j = SLICE_COUNT - i; j < SLICE_COUNT; ++j) {
+        if (right[j] != 0) return false;
+      }
+    }
+    return true;
+  }
+};
+}
+
+namespace std { // NOLINT(cert-dcl58-cpp)
+
+template <size_t Bits>
+inline string to_string(const pzl::FixedInteger<Bits> &integer) {
+  return integer.toString();
+}
+}
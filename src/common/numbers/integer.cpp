@@ -21,24 +21,20 @@
  */
 
 #include "integer.h"
+#include "integer_kernels.h"
+#include "montgomery.h"
 
 #include "common/assertions.h" // ensure
-#include "common/strings.h"    // Puzzles::padLeading
 #include "compat/compare.h"    // compat::strong_ordering, compat::compare
 
-#include <cmath> // std::pow
+#include <algorithm> // std::copy, std::max
+#include <limits>    // std::numeric_limits
+#include <vector>    // std::vector
 
 using pzl::Integer;
-
-constexpr Integer::value_t SLICE_MAX = 999999999;
-constexpr Integer::value_t SLICE_SIZE = SLICE_MAX + 1;
-
-template <typename value_t, typename iterator>
-inline value_t valueAndAdvance(iterator *it) {
-  value_t value = **it;
-  std::advance(*it, 1);
-  return value;
-}
+using pzl::kernels::SLICE_BITS;
+using pzl::kernels::SLICE_MAX;
+using pzl::kernels::SLICE_SIZE;
 
 Integer::Integer(const std::string &value) : _positive(value.empty() || value[0] != '-') {
   if (value.empty() || value == "0") {
@@ -50,144 +46,75 @@ Integer::Integer(const std::string &value) : _positive(value.empty() || value[0]
   if (offset[0] == '-') {
     offset = offset.substr(1);
   }
-  ensure(offset.substr(1).find_first_not_of("0123456789") == value.npos);
-
-  auto it = offset.crbegin();
-  while (it != offset.crend()) {
-    uint_fast32_t result = 0;
-    for (auto i = 0; i < 9; ++i) {
-      if (it != offset.crend()) {
-        auto digit = valueAndAdvance<char>(&it) - '0';
-        result += digit * std::pow(10, i);
-      }
-    }
-    this->slices.push_back(result);
-  }
-}
+  ensure(!offset.empty()); // The digits themselves get checked while parsing them
 
-Integer::Integer(intmax_t value) : _positive(value >= 0) {
-  value = std::abs(value);
-  while (value > 0) {
-    auto slice = value % static_cast<value_t>(SLICE_SIZE);
-    slices.push_back(static_cast<uintmax_t>(slice));
-    value = (value - slice) / SLICE_SIZE;
-  }
-  slices.shrink_to_fit();
+  this->slices = kernels::parseDecimal(offset);
+  this->_positive = this->_positive || this->slices.empty();
 }
 
 std::string Integer::toString() const {
-  if (slices.empty()) {
-    ensure(_positive);
-    return "0";
-  }
-
-  std::string result;
-  for (auto slice : slices) {
-    auto nextSlice = std::to_string(slice);
-    auto paddedSlice = Puzzles::padLeading(nextSlice, 9, '0');
-    result.insert(0, paddedSlice);
-  }
-
-  result = Puzzles::trimLeading(result, '0');
-
-  if (!_positive) {
-    result.insert(0, 1, '-');
-  }
+  // Sizing the string once and filling it back to front, so the only thing left is dropping whatever the bound overshot
+  std::string result(kernels::decimalDigitsBound(slices) + 1, '\0');
+  auto *last = result.data() + result.size();
+  auto *first = kernels::formatDecimal(slices, last);
+  if (!_positive) *--first = '-';
 
+  result.erase(0, static_cast<size_t>(first - result.data()));
   return result;
 }
 
-inline compat::strong_ordering compareSlices(const std::vector<Integer::value_t> &left,
-                                             const std::vector<Integer::value_t> &right) {
-  auto lengthComparison = compat::compare(left.size(), right.size());
-  if (lengthComparison != compat::strong_ordering::equal) {
-    return lengthComparison;
-  }
-
-  auto lit = left.crbegin(), rit = right.crbegin();
-  while (lit != left.crend()) {
-    ensure(rit != right.crend());
+std::to_chars_result Integer::toChars(char *first, char *last) const {
+  auto bound = kernels::decimalDigitsBound(slices) + (_positive ? 0 : 1);
 
-    auto sliceComparison = compat::compare(*lit, *rit);
-    if (sliceComparison == compat::strong_ordering::equal) {
-      ++lit;
-      ++rit;
-      continue;
-    }
+  if (static_cast<size_t>(last - first) >= bound) {
+    auto *start = kernels::formatDecimal(slices, first + bound);
+    if (!_positive) *--start = '-';
 
-    return sliceComparison;
+    if (start == first) return {first + bound, std::errc{}};
+    return {std::copy(start, first + bound, first), std::errc{}};
   }
 
-  return compat::strong_ordering::equal;
+  // The bound might overshoot a little, so it could still fit
+  auto result = toString();
+  if (result.size() > static_cast<size_t>(last - first)) return {last, std::errc::value_too_large};
+  return {std::copy(result.cbegin(), result.cend(), first), std::errc{}};
+}
+
+compat::strong_ordering Integer::compareSlices(const slices_t &left, const slices_t &right) {
+  return pzl::kernels::compare(left, right);
 }
 
-Integer Integer::operator+(const Integer &o) const {
+Integer Integer::add(const Integer &o) const {
   if (slices.empty()) return o;
   if (o.slices.empty()) return *this;
 
   auto sameSign = this->positive() == o.positive();
-  if (!sameSign && this->slices == o.slices) {
-    return Integer(0);
-  }
-
-  bool finalSign;
-  typeof(slices.cbegin()) lit, rit;
-  typeof(slices.cend()) lend, rend;
 
   // if sameSign, we don't care about the order, so we can avoid the compareSlices call
-  if (sameSign || compareSlices(this->slices, o.slices) != compat::strong_ordering::less) {
-    finalSign = this->_positive;
-    lit = this->slices.cbegin();
-    lend = this->slices.cend();
-
-    rit = o.slices.cbegin();
-    rend = o.slices.cend();
+  const auto *bigger = this, *smaller = &o;
+  if (sameSign) {
+    if (bigger->slices.size() < smaller->slices.size()) std::swap(bigger, smaller);
   } else {
-    finalSign = o._positive;
-    lit = o.slices.cbegin();
-    lend = o.slices.cend();
-
-    rit = this->slices.cbegin();
-    rend = this->slices.cend();
-  }
-
-  std::vector<value_t> result;
-  result.reserve(std::max(this->slices.size(), o.slices.size()) + 1);
-
-  int_fast64_t carryOver = 0;
-
-  while (lit != lend || rit != rend) {
-    int_fast64_t lbit = lit == lend ? 0 : valueAndAdvance<value_t>(&lit);
-    int_fast64_t rbit = rit == rend ? 0 : valueAndAdvance<value_t>(&rit);
-    int_fast64_t sum = sameSign ? lbit + rbit + carryOver : lbit - rbit - carryOver;
-
-    ensure(sum >= (SLICE_SIZE * static_cast<intmax_t>(-1)) && sum <= (SLICE_SIZE * 2 - 1));
-
-    if (sum < 0) {
-      carryOver = 1;
-      sum += SLICE_SIZE;
-    } else if (sum > SLICE_MAX) {
-      carryOver = 1;
-      sum -= SLICE_SIZE;
-    } else {
-      carryOver = 0;
-    }
-
-    result.push_back(sum);
+    auto comparison = compareSlices(this->slices, o.slices);
+    if (comparison == compat::strong_ordering::equal) return Integer{0};
+    if (comparison == compat::strong_ordering::less) std::swap(bigger, smaller);
   }
 
-  ensure_m(carryOver == 0 || (carryOver == 1 && sameSign), "carry over is " << carryOver);
-  if (carryOver) result.push_back(1);
+  slices_t result(bigger->slices.size() + (sameSign ? 1 : 0), 0);
+  std::copy(bigger->slices.cbegin(), bigger->slices.cend(), result.begin());
 
-  while (result.back() == 0) {
-    result.pop_back();
-    ensure_m(!result.empty(), "sum is 0, but we should've left the function at the beginning");
+  if (sameSign) {
+    kernels::addInto(result.data(), result.size(), smaller->slices);
+  } else {
+    auto borrow = kernels::subtractFrom(result.data(), result.size(), smaller->slices);
+    ensure(borrow == 0);
   }
+  kernels::trim(&result);
 
-  return Integer(result, finalSign);
+  return Integer{std::move(result), bigger->_positive};
 }
 
-Integer Integer::operator-(const Integer &o) const {
+Integer Integer::subtract(const Integer &o) const {
   if (this->slices.empty()) return Integer{o.slices, !o._positive};
   if (*this == o) return Integer{0};
 
@@ -201,177 +128,412 @@ Integer Integer::operator-(const Integer &o) const {
   return *this + Integer{o.slices, !o._positive};
 }
 
-Integer Integer::operator*(const Integer &o) const {
+Integer Integer::multiply(const Integer &o) const {
   if (slices.empty() || o.slices.empty()) return Integer{0};
 
-  auto min = this->absolute();
-  auto max = o.absolute();
+  slices_t result(this->slices.size() + o.slices.size());
+  kernels::multiply(this->slices, o.slices, result.data());
+  kernels::trim(&result);
 
-  if (compareSlices(this->slices, o.slices) == compat::strong_ordering::greater) {
-    std::swap(min, max);
-  }
+  return Integer{std::move(result), this->positive() == o.positive()};
+}
 
-  Integer result{0};
-  for (Integer i{0}; i < min; ++i) {
-    result += max;
-  }
+Integer Integer::operator/(const Integer &o) const {
+  return divmod(o).first;
+}
 
-  result._positive = this->positive() == o.positive();
+Integer Integer::operator%(const Integer &o) const {
+  return divmod(o).second;
+}
+
+std::pair<Integer, Integer> Integer::divmod(const Integer &o) const {
+  std::pair<Integer, Integer> result{Integer{0}, *this};
+  result.first = result.second.divmodInPlace(o);
   return result;
 }
 
-Integer Integer::operator/(const Integer &o) const {
+Integer Integer::divmodInPlace(const Integer &o) {
   ensure(o != 0); // division by zero is undefined
 
-  if (slices.empty()) { // Zero divided by anything is always zero
-    return *this;
+  if (compareSlices(this->slices, o.slices) == compat::strong_ordering::less) {
+    return Integer{0}; // We're already the remainder
   }
 
-  // if (this < o) then (this / o) will be a fraction, which we don't support
-  ensure_m(o.absolute() <= this->absolute(),
-           "this is [" << std::to_string(*this) << "], o is [" << std::to_string(o) << "]");
+  auto quotientPositive = this->positive() == o.positive();
+  slices_t quotient(this->slices.size() - o.slices.size() + 1);
+  kernels::divide(this->slices, o.slices, quotient.data(), this->slices.data());
+  kernels::trim(&quotient);
 
-  // Now for the actual division implementation
-  Integer remainder{this->slices, true};
-  Integer result{0};
+  this->slices.resize(o.slices.size());
+  kernels::trim(&this->slices);
+  this->_positive = this->_positive || this->slices.empty();
 
-  if (o.slices.size() == 1) {
-    // Optimizing this common scenario
-    auto base = o.slices[0];
-    std::vector<std::pair<intmax_t, intmax_t>> stepSizes;
-    stepSizes.emplace_back(1, base);
+  return Integer{std::move(quotient), quotientPositive};
+}
 
-    constexpr auto max = std::numeric_limits<intmax_t>::max() / 2;
-    for (intmax_t i = 2; i <= max && (*this > stepSizes.back().second); i *= 2) {
-      stepSizes.emplace_back(i, i * base);
-    }
+void Integer::addInPlace(const slices_t &other, bool otherPositive) {
+  if (other.empty()) return;
+  if (&other == &this->slices) {
+    // Growing our slices would invalidate `other`, so we need a copy of it
+    addInPlace(slices_t{other}, otherPositive);
+    return;
+  }
 
-    for (auto it = stepSizes.crbegin(); it != stepSizes.crend(); ++it) {
-      auto [i, stepSize] = *it;
-      Integer step{stepSize};
-      while (step <= remainder) {
-        remainder -= step;
-        result = result + i;
-        ensure(remainder.positive()); // We don't support fractions, to we should always stop exactly at 0
-      }
-    }
-  } else {
-    auto step = o.absolute();
+  if (slices.empty()) {
+    slices = other;
+    _positive = otherPositive;
+    return;
+  }
 
-    while (!remainder.slices.empty()) {
-      remainder -= step;
-      ++result;
-      ensure(remainder.positive()); // We don't support fractions, to we should always stop exactly at 0
-    }
+  if (_positive == otherPositive) {
+    slices.resize(std::max(slices.size(), other.size()) + 1);
+    kernels::addInto(slices.data(), slices.size(), other);
+    kernels::trim(&slices);
+    return;
   }
 
-  result._positive = this->positive() == o.positive() || result.slices.empty();
-  return result;
-}
+  auto comparison = compareSlices(slices, other);
+  if (comparison == compat::strong_ordering::equal) {
+    slices.clear();
+    _positive = true;
+    return;
+  }
 
-Integer Integer::operator%(const Integer &o) const {
-  ensure(o != 0); // division by zero is undefined
+  if (comparison == compat::strong_ordering::greater) {
+    auto borrow = kernels::subtractFrom(slices.data(), slices.size(), other);
+    ensure(borrow == 0);
+  } else {
+    slices.resize(other.size());
+    auto borrow = kernels::subtractReversed(slices.data(), slices.size(), other);
+    ensure(borrow == 0);
+    _positive = otherPositive;
+  }
+  kernels::trim(&slices);
+}
 
-  if (slices.empty()) { // Zero divided by anything is always zero
-    return *this;
+void Integer::multiplyInPlace(const Integer &o) {
+  if (slices.empty()) return;
+  if (o.slices.empty()) {
+    slices.clear();
+    _positive = true;
+    return;
   }
 
-  Integer remainder{this->slices, true};
+  _positive = _positive == o._positive;
 
   if (o.slices.size() == 1) {
-    // Optimizing this common scenario
-    auto base = o.slices[0];
-    std::vector<intmax_t> stepSizes;
-    stepSizes.push_back(base);
+    auto multiplier = o.slices[0]; // In case o is this
+    auto overflow = kernels::multiplyBySlice(slices.data(), slices.size(), multiplier);
+    if (overflow) slices.push_back(overflow);
+    return;
+  }
 
-    constexpr auto max = std::numeric_limits<intmax_t>::max() / 2;
-    for (intmax_t i = 2; i <= max && (*this > stepSizes.back()); i *= 2) {
-      stepSizes.push_back(i * base);
-    }
+  // The kernels can't multiply into their own inputs, so this one does need a buffer
+  slices_t result(slices.size() + o.slices.size());
+  kernels::multiply(slices, o.slices, result.data());
+  kernels::trim(&result);
+  slices = std::move(result);
+}
 
-    for (auto it = stepSizes.crbegin(); it != stepSizes.crend(); ++it) {
-      auto stepSize = *it;
-      Integer step{stepSize};
-      while (step <= remainder) {
-        remainder -= stepSize;
-      }
-    }
-  } else {
-    auto step = o.absolute();
-    while (step <= remainder) {
-      remainder -= step;
-    }
+void Integer::operator/=(const Integer &o) {
+  ensure(o != 0); // division by zero is undefined
+
+  if (o.slices.size() == 1) {
+    auto quotientPositive = _positive == o._positive;
+    kernels::divideBySlice(slices.data(), slices.size(), o.slices[0]);
+    kernels::trim(&slices);
+    _positive = quotientPositive || slices.empty();
+    return;
   }
 
-  remainder._positive = this->positive() == o.positive() || remainder.slices.empty();
-  return remainder;
+  *this = divmodInPlace(o);
 }
 
-Integer Integer::operator+(intmax_t value) const {
+Integer Integer::add(intmax_t value) const {
   if (value == 0) return *this;
   if (slices.empty()) return Integer{value};
 
   auto sameSign = (value >= 0 && this->positive()) || (value < 0 && !this->positive());
-  auto absValue = std::abs(value);
-  if (sameSign && absValue + slices[0] < 1000000000) {
+  auto absValue = magnitudeOf(value);
+  if (sameSign && absValue <= SLICE_MAX - slices[0]) {
     Integer result{*this};
-    result.slices[0] += absValue;
+    result.slices[0] += static_cast<value_t>(absValue);
     return result;
   }
 
   return *this + Integer{value};
 }
 
-Integer Integer::operator*(intmax_t value) const {
-  switch (value) {
-  case 0:
-    return Integer{0};
-  case 1:
-    return *this;
-  case -1:
-    return Integer{slices, !_positive};
-  default:
-    return *this * Integer(value);
+Integer Integer::subtract(intmax_t value) const {
+  if (value == 0) return *this;
+  if (slices.empty()) return -Integer{value};
+
+  // Subtracting a value of the other sign grows the magnitude, so only then can it stay in the lowest slice
+  auto growsMagnitude = (value < 0) == this->positive();
+  auto absValue = magnitudeOf(value);
+  if (growsMagnitude && absValue <= SLICE_MAX - slices[0]) {
+    Integer result{*this};
+    result.slices[0] += static_cast<value_t>(absValue);
+    return result;
   }
+
+  return *this - Integer{value};
 }
 
-Integer Integer::power(const Integer &exponent) const {
-  ensure(*this != 0 || exponent != 0); // zero ^ zero is undefined
-  ensure(exponent.positive());         // Haven't implemented this yet
+Integer Integer::multiply(intmax_t value) const {
+  // Making room for the product up front, so multiplying in place won't have to grow the slices again
+  slices_t copy;
+  copy.reserve(slices.size() + 1);
+  copy.assign(slices.begin(), slices.end());
 
-  Integer result{1};
+  Integer result{std::move(copy), _positive};
+  result *= value;
+  return result;
+}
 
-  for (Integer i{0}; i < exponent; ++i) {
-    result *= *this;
+void Integer::multiplyInPlace(intmax_t value) {
+  if (slices.empty()) return;
+  if (value == 0) {
+    slices.clear();
+    _positive = true;
+    return;
   }
 
+  _positive = _positive == (value > 0);
+
+  auto magnitude = magnitudeOf(value);
+  if (magnitude <= SLICE_MAX) {
+    auto overflow = kernels::multiplyBySlice(slices.data(), slices.size(), static_cast<value_t>(magnitude));
+    if (overflow) slices.push_back(overflow);
+    return;
+  }
+
+  static_assert(std::numeric_limits<uintmax_t>::digits <= SLICE_BITS * 2);
+  value_t scalar[] = {static_cast<value_t>(magnitude), static_cast<value_t>(magnitude >> SLICE_BITS)};
+
+  slices_t result(slices.size() + 2);
+  kernels::multiply(slices, kernels::SlicesView{scalar, 2}, result.data());
+  kernels::trim(&result);
+  slices = std::move(result);
+}
+
+size_t Integer::bitLength() const {
+  return kernels::bitLength(slices);
+}
+
+size_t Integer::countTrailingZeros() const {
+  ensure(!slices.empty()); // Zero doesn't have any set bits to count up to
+  return kernels::countTrailingZeros(slices);
+}
+
+size_t Integer::popCount() const {
+  return kernels::popCount(slices);
+}
+
+Integer Integer::operator<<(size_t bits) const {
+  if (slices.empty()) return *this;
+
+  slices_t result(slices.size() + bits / SLICE_BITS + 1);
+  kernels::shiftLeft(slices, bits, result.data());
+  kernels::trim(&result);
+  return Integer{std::move(result), _positive};
+}
+
+Integer Integer::operator>>(size_t bits) const {
+  auto result = *this;
+  result >>= bits;
   return result;
 }
 
-bool Integer::operator<(const Integer &o) const {
-  if (this->positive() != o.positive()) {
-    return this->positive() < o.positive();
-  }
+void Integer::operator<<=(size_t bits) {
+  if (slices.empty()) return;
+
+  auto size = slices.size();
+  slices.resize(size + bits / SLICE_BITS + 1);
+  kernels::shiftLeft(kernels::SlicesView{slices.data(), size}, bits, slices.data());
+  kernels::trim(&slices);
+}
+
+void Integer::operator>>=(size_t bits) {
+  if (slices.empty()) return;
 
-  auto sliceComparison = compareSlices(this->slices, o.slices);
-  if (this->positive()) {
-    return sliceComparison == compat::strong_ordering::less;
+  // Rounding a negative number down means rounding its magnitude up, whenever any of the bits we drop were set
+  auto roundUp = !_positive && kernels::countTrailingZeros(slices) < bits;
+
+  auto offset = bits / SLICE_BITS;
+  if (offset >= slices.size()) {
+    slices.clear();
   } else {
-    return sliceComparison == compat::strong_ordering::greater;
+    kernels::shiftRight(slices, bits, slices.data());
+    slices.resize(slices.size() - offset);
+    kernels::trim(&slices);
+  }
+
+  if (roundUp) {
+    const value_t one = 1;
+    slices.push_back(0);
+    kernels::addInto(slices.data(), slices.size(), kernels::SlicesView{&one, 1});
+    kernels::trim(&slices);
   }
+  _positive = _positive || slices.empty();
 }
 
-bool Integer::operator<=(const Integer &o) const {
-  if (this->positive() != o.positive()) {
-    return this->positive() < o.positive();
+namespace {
+
+// Flips every bit and adds one
+void negate(Integer::slices_t *slices) {
+  Integer::value_t carry = 1;
+  for (auto &slice : *slices) {
+    slice = ~slice + carry;
+    carry = carry && slice == 0;
   }
+}
 
-  auto bitComparison = compareSlices(this->slices, o.slices);
-  if (this->positive()) {
-    return bitComparison != compat::strong_ordering::greater;
-  } else {
-    return bitComparison != compat::strong_ordering::less;
+// `size` needs to leave room for the sign bit
+Integer::slices_t toTwosComplement(const Integer::slices_t &magnitude, bool positive, size_t size) {
+  Integer::slices_t result(size);
+  std::copy(magnitude.begin(), magnitude.end(), result.begin());
+  if (!positive) negate(&result);
+  return result;
+}
+}
+
+template <typename Operation>
+Integer Integer::bitwise(const Integer &o, Operation operation) const {
+  auto size = std::max(slices.size(), o.slices.size()) + 1;
+  auto result = toTwosComplement(slices, _positive, size);
+  auto other = toTwosComplement(o.slices, o._positive, size);
+
+  for (size_t i = 0; i < size; ++i) {
+    result[i] = operation(result[i], other[i]);
+  }
+
+  // The extra slice holds nothing but sign bits
+  auto positive = (result.back() >> (SLICE_BITS - 1)) == 0;
+  if (!positive) negate(&result);
+
+  kernels::trim(&result);
+  return Integer{std::move(result), positive};
+}
+
+Integer Integer::operator&(const Integer &o) const {
+  return bitwise(o, [](value_t left, value_t right) { return left & right; });
+}
+
+Integer Integer::operator|(const Integer &o) const {
+  return bitwise(o, [](value_t left, value_t right) { return left | right; });
+}
+
+Integer Integer::operator^(const Integer &o) const {
+  return bitwise(o, [](value_t left, value_t right) { return left ^ right; });
+}
+
+compat::strong_ordering Integer::compareToScalar(intmax_t o) const {
+  if (_positive != (o >= 0)) {
+    return _positive ? compat::strong_ordering::greater : compat::strong_ordering::less;
+  }
+
+  auto comparison = kernels::compareToScalar(slices, magnitudeOf(o));
+  return _positive ? comparison : reversed(comparison);
+}
+
+namespace {
+
+// Reads the exponent's bits straight out of its slices, instead of copying them into a std::vector<bool>
+struct BinaryDigits {
+  const Integer::slices_t &slices;
+
+  [[nodiscard]] inline bool operator[](size_t i) const { return (slices[i / SLICE_BITS] >> (i % SLICE_BITS)) & 1; }
+
+  [[nodiscard]] inline size_t size() const { return pzl::kernels::bitLength(slices); }
+};
+
+// Left-to-right sliding window exponentiation, calling `reduce` after every multiplication
+template <typename Reduce>
+Integer slidingWindowPower(const Integer &base, const BinaryDigits &exponent, const Reduce &reduce) {
+  Integer result{1};
+  auto bits = exponent.size();
+  if (bits == 0) return result;
+
+  // Bigger windows mean fewer multiplications, but more odd powers to precalculate
+  size_t windowSize = bits > 671 ? 6 : bits > 239 ? 5 : bits > 79 ? 4 : bits > 23 ? 3 : 1;
+
+  // oddPowers[i] = base ^ (2i + 1), we don't need any of them (nor their allocation) without a window
+  std::vector<Integer> oddPowers;
+  if (windowSize > 1) {
+    oddPowers.reserve(size_t{1} << (windowSize - 1));
+    oddPowers.push_back(base);
+    auto square = base * base;
+    reduce(&square);
+    for (size_t i = 1; i < (size_t{1} << (windowSize - 1)); ++i) {
+      auto next = oddPowers.back() * square;
+      reduce(&next);
+      oddPowers.push_back(std::move(next));
+    }
+  }
+
+  auto i = bits;
+  while (i > 0) {
+    if (!exponent[i - 1]) {
+      result = result * result;
+      reduce(&result);
+      --i;
+      continue;
+    }
+
+    // Find the longest window that starts at this bit and ends at a set bit
+    auto windowStart = i > windowSize ? i - windowSize : 0;
+    while (!exponent[windowStart]) {
+      ++windowStart;
+    }
+
+    size_t window = 0;
+    for (auto j = i; j > windowStart; --j) {
+      result = result * result;
+      reduce(&result);
+      window = (window << 1) | exponent[j - 1];
+    }
+
+    result = result * (window == 1 ? base : oddPowers[window >> 1]);
+    reduce(&result);
+    i = windowStart;
   }
+
+  return result;
+}
+}
+
+Integer Integer::exponentiate(const Integer &exponent) const {
+  ensure(*this != 0 || exponent != 0); // zero ^ zero is undefined
+  ensure(exponent.positive());         // Haven't implemented this yet
+
+  return slidingWindowPower(*this, BinaryDigits{exponent.slices}, [](Integer *) {});
+}
+
+Integer Integer::powMod(const Integer &exponent, const Integer &modulus) const {
+  ensure(*this != 0 || exponent != 0); // zero ^ zero is undefined
+  ensure(exponent.positive());         // Haven't implemented this yet
+  ensure(modulus != 0);                // division by zero is undefined
+
+  auto absoluteModulus = modulus.absolute();
+
+  // Montgomery form trades every division for a couple of multiplications, but it only works for odd moduli
+  if ((absoluteModulus.slices[0] & 1) == 1 && absoluteModulus != 1) {
+    return MontgomeryContext{absoluteModulus}.powMod(*this, exponent);
+  }
+
+  auto reduce = [&absoluteModulus](Integer *value) { value->divmodInPlace(absoluteModulus); };
+
+  auto base = *this;
+  reduce(&base);
+
+  auto result = slidingWindowPower(base, BinaryDigits{exponent.slices}, reduce);
+  reduce(&result);
+  if (!result.positive()) {
+    result += absoluteModulus;
+  }
+
+  return result;
 }
 
 Integer &Integer::operator++() {
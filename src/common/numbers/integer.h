@@ -22,36 +22,141 @@
 
 #pragma once
 
-#include "compat/defs.h"
+#include "common/assertions.h" // ensure
+#include "common/small_vector.h"
+#include "compat/compare.h" // compat::strong_ordering
+#include "compat/defs.h"    // pzl_constexpr, compat::isConstantEvaluated
 
-#include <cstdint> // uint32_t, intmax_t
-#include <string>  // std::string
-#include <vector>  // std::vector
+#include <algorithm> // std::max
+#include <array>     // std::array
+#include <charconv>  // std::to_chars_result
+#include <cstddef>   // size_t
+#include <cstdint>   // uint32_t, uint64_t, intmax_t
+#include <limits>    // std::numeric_limits
+#include <string>    // std::string
+#include <tuple>     // std::tuple
+#include <utility>   // std::pair
 
 namespace pzl {
 
+template <typename Storage>
+struct BasicMontgomeryContext;
+
+template <size_t Bits>
+struct FixedInteger;
+
+struct Integer;
+
+namespace expressions {
+Integer multiplyAdd(const Integer &left, const Integer &right, const Integer &addend, bool subtract);
+Integer multiplyAdd(const Integer &value, intmax_t multiplier, intmax_t addend, bool subtract);
+void multiplyAddInPlace(Integer *value, intmax_t multiplier, intmax_t addend, bool subtract);
+}
+
+namespace literals {
+template <char... characters>
+pzl_constexpr Integer operator""_Z();
+}
+
+// The arithmetic and comparison operators, along with power, are also constexpr where the compiler allows allocating
+// during constant evaluation; that takes plain schoolbook loops instead of the kernels, so it's only quick for small
+// numbers, and since the allocations can't outlive the evaluation, only values up to 128 bits can be constants
 struct Integer {
 
   using value_t = uint32_t;
+  // Up to 128 bits live inline, which covers pretty much every Integer outside of the big number tests
+  using slices_t = Puzzles::SmallVector<value_t, 4>;
 
   explicit Integer(const std::string &);
-  explicit Integer(intmax_t value);
+  pzl_constexpr explicit Integer(intmax_t value) : _positive(value >= 0) {
+    for (auto magnitude = magnitudeOf(value); magnitude > 0; magnitude >>= std::numeric_limits<value_t>::digits) {
+      slices.push_back(static_cast<value_t>(magnitude));
+    }
+  }
 
-  [[nodiscard]] inline Integer absolute() const { return Integer{slices, true}; }
-  [[nodiscard]] inline bool positive() const { return _positive; }
+  // The rvalue overloads of absolute and unary minus hand over the slices instead of copying them
+  [[nodiscard]] inline pzl_constexpr Integer absolute() const & { return Integer{slices, true}; }
+  [[nodiscard]] inline pzl_constexpr Integer absolute() && { return Integer{std::move(slices), true}; }
+  [[nodiscard]] inline pzl_constexpr bool positive() const { return _positive; }
   [[nodiscard]] std::string toString() const;
+  // Same as std::to_chars, writes the digits (without a null terminator) and returns where they end
+  std::to_chars_result toChars(char *first, char *last) const;
+
+  [[nodiscard]] inline pzl_constexpr Integer operator-() const & { return Integer{slices, !_positive}; }
+  [[nodiscard]] inline pzl_constexpr Integer operator-() && { return Integer{std::move(slices), !_positive}; }
+
+  [[nodiscard]] pzl_constexpr Integer operator+(const Integer &o) const {
+    if (!compat::isConstantEvaluated()) return add(o);
+    auto result = *this;
+    result.constantAddInPlace(o.slices, o._positive);
+    return result;
+  }
+
+  [[nodiscard]] pzl_constexpr Integer operator-(const Integer &o) const {
+    if (!compat::isConstantEvaluated()) return subtract(o);
+    auto result = *this;
+    result.constantAddInPlace(o.slices, !o._positive);
+    return result;
+  }
+
+  [[nodiscard]] pzl_constexpr Integer operator*(const Integer &o) const {
+    if (!compat::isConstantEvaluated()) return multiply(o);
+    auto result = *this;
+    result.constantMultiplyInPlace(o.slices, o._positive);
+    return result;
+  }
 
-  [[nodiscard]] Integer operator+(const Integer &) const;
-  [[nodiscard]] Integer operator-(const Integer &) const;
-  [[nodiscard]] Integer operator*(const Integer &) const;
   [[nodiscard]] Integer operator/(const Integer &) const;
   [[nodiscard]] Integer operator%(const Integer &) const;
 
-  [[nodiscard]] Integer operator+(intmax_t) const;
-  [[nodiscard]] inline Integer operator-(intmax_t o) const { return *this + -o; }
-  [[nodiscard]] Integer operator*(intmax_t) const;
+  // Truncated division, so (quotient * o + remainder) is *this, and the remainder has the same sign as *this
+  [[nodiscard]] std::pair<Integer, Integer> divmod(const Integer &o) const;
+  // Same as divmod, but turns this into the remainder instead of allocating a new Integer for it
+  Integer divmodInPlace(const Integer &o);
+
+  [[nodiscard]] inline pzl_constexpr Integer operator+(intmax_t o) const {
+    return compat::isConstantEvaluated() ? *this + Integer{o} : add(o);
+  }
+  [[nodiscard]] inline pzl_constexpr Integer operator-(intmax_t o) const {
+    return compat::isConstantEvaluated() ? *this - Integer{o} : subtract(o);
+  }
+  [[nodiscard]] inline pzl_constexpr Integer operator*(intmax_t o) const {
+    return compat::isConstantEvaluated() ? *this * Integer{o} : multiply(o);
+  }
+
+  // These look at the magnitude alone, so they ignore the sign; countTrailingZeros is undefined for zero
+  [[nodiscard]] size_t bitLength() const;
+  [[nodiscard]] size_t countTrailingZeros() const;
+  [[nodiscard]] size_t popCount() const;
+
+  // Shifting right rounds towards negative infinity, the same as it does in two's complement
+  [[nodiscard]] Integer operator<<(size_t) const;
+  [[nodiscard]] Integer operator>>(size_t) const;
 
-  [[nodiscard]] Integer power(const Integer &) const;
+  // These treat negative numbers as if they were in two's complement, with as many sign bits as they need
+  [[nodiscard]] Integer operator&(const Integer &) const;
+  [[nodiscard]] Integer operator|(const Integer &) const;
+  [[nodiscard]] Integer operator^(const Integer &) const;
+  inline void operator&=(const Integer &o) { *this = *this & o; }
+  inline void operator|=(const Integer &o) { *this = *this | o; }
+  inline void operator^=(const Integer &o) { *this = *this ^ o; }
+
+  [[nodiscard]] pzl_constexpr Integer power(const Integer &exponent) const {
+    if (!compat::isConstantEvaluated()) return exponentiate(exponent);
+    ensure(*this != 0 || exponent != 0); // zero ^ zero is undefined
+    ensure(exponent.positive());         // Haven't implemented this yet
+
+    Integer result{1};
+    for (auto i = exponent.slices.size(); i-- > 0;) {
+      for (auto bit = std::numeric_limits<value_t>::digits; bit-- > 0;) {
+        result *= result;
+        if ((exponent.slices[i] >> bit) & 1) result *= *this;
+      }
+    }
+    return result;
+  }
+  // (this ^ exponent) % modulus, always in the [0, |modulus|) range
+  [[nodiscard]] Integer powMod(const Integer &exponent, const Integer &modulus) const;
 
 #ifdef __cpp_lib_three_way_comparison
   [[nodiscard]] inline bool operator==(const Integer &) const = default;
@@ -65,34 +170,347 @@ struct Integer {
   }
 #endif
 
-  [[nodiscard]] bool operator<(const Integer &) const;
-  [[nodiscard]] bool operator<=(const Integer &) const;
-  [[nodiscard]] inline bool operator>(const Integer &o) const { return o < *this; }
-  [[nodiscard]] inline bool operator>=(const Integer &o) const { return o <= *this; }
+  // One pass over the slices, and every relational operator comes from it
+  [[nodiscard]] pzl_constexpr compat::strong_ordering compareTo(const Integer &o) const {
+    if (_positive != o._positive) {
+      return _positive ? compat::strong_ordering::greater : compat::strong_ordering::less;
+    }
 
-  [[nodiscard]] inline bool operator==(intmax_t o) const { return *this == Integer{o}; }
-  [[nodiscard]] inline bool operator!=(intmax_t o) const { return *this != Integer{o}; }
-  [[nodiscard]] inline bool operator<(intmax_t o) const { return *this < Integer{o}; }
-  [[nodiscard]] inline bool operator<=(intmax_t o) const { return *this <= Integer{o}; }
-  [[nodiscard]] inline bool operator>(intmax_t o) const { return *this > Integer{o}; }
+    auto comparison =
+        compat::isConstantEvaluated() ? compareMagnitudes(slices, o.slices) : compareSlices(slices, o.slices);
+    return _positive ? comparison : reversed(comparison);
+  }
 
+  // At runtime, this one compares straight against the slices, without turning the scalar into an Integer first
+  [[nodiscard]] inline pzl_constexpr compat::strong_ordering compareTo(intmax_t o) const {
+    return compat::isConstantEvaluated() ? compareTo(Integer{o}) : compareToScalar(o);
+  }
+
+  [[nodiscard]] inline pzl_constexpr bool operator==(intmax_t o) const {
+    return compareTo(o) == compat::strong_ordering::equal;
+  }
+  [[nodiscard]] inline pzl_constexpr bool operator!=(intmax_t o) const {
+    return compareTo(o) != compat::strong_ordering::equal;
+  }
+
+#ifdef __cpp_lib_three_way_comparison
+  [[nodiscard]] inline pzl_constexpr std::strong_ordering operator<=>(const Integer &o) const { return compareTo(o); }
+  [[nodiscard]] inline pzl_constexpr std::strong_ordering operator<=>(intmax_t o) const { return compareTo(o); }
+#else
+  [[nodiscard]] inline bool operator<(const Integer &o) const { return compareTo(o) == compat::strong_ordering::less; }
+  [[nodiscard]] inline bool operator<=(const Integer &o) const {
+    return compareTo(o) != compat::strong_ordering::greater;
+  }
+  [[nodiscard]] inline bool operator>(const Integer &o) const {
+    return compareTo(o) == compat::strong_ordering::greater;
+  }
+  [[nodiscard]] inline bool operator>=(const Integer &o) const { return compareTo(o) != compat::strong_ordering::less; }
+
+  [[nodiscard]] inline bool operator<(intmax_t o) const { return compareTo(o) == compat::strong_ordering::less; }
+  [[nodiscard]] inline bool operator<=(intmax_t o) const { return compareTo(o) != compat::strong_ordering::greater; }
+  [[nodiscard]] inline bool operator>(intmax_t o) const { return compareTo(o) == compat::strong_ordering::greater; }
+  [[nodiscard]] inline bool operator>=(intmax_t o) const { return compareTo(o) != compat::strong_ordering::less; }
+#endif
+
+  // These all work on the existing slices, so they only allocate when the result outgrows them
   Integer &operator++();
-  inline void operator+=(const Integer &o) { *this = *this + o; }
-  inline void operator-=(const Integer &o) { *this = *this - o; }
-  inline void operator*=(const Integer &o) { *this = *this * o; }
-  inline void operator/=(const Integer &o) { *this = *this / o; }
-  inline void operator%=(const Integer &o) { *this = *this % o; }
+  inline pzl_constexpr void operator+=(const Integer &o) {
+    if (compat::isConstantEvaluated()) {
+      constantAddInPlace(o.slices, o._positive);
+    } else {
+      addInPlace(o.slices, o._positive);
+    }
+  }
+  inline pzl_constexpr void operator-=(const Integer &o) {
+    if (compat::isConstantEvaluated()) {
+      constantAddInPlace(o.slices, !o._positive);
+    } else {
+      addInPlace(o.slices, !o._positive);
+    }
+  }
+  inline pzl_constexpr void operator*=(const Integer &o) {
+    if (compat::isConstantEvaluated()) {
+      constantMultiplyInPlace(o.slices, o._positive);
+    } else {
+      multiplyInPlace(o);
+    }
+  }
+  void operator/=(const Integer &o);
+  inline void operator%=(const Integer &o) { divmodInPlace(o); }
+
+  void operator<<=(size_t);
+  void operator>>=(size_t);
 
-  inline void operator-=(intmax_t &o) { *this = *this - o; }
-  inline void operator*=(intmax_t o) { *this = *this * o; }
+  inline pzl_constexpr void operator+=(intmax_t o) { *this += Integer{o}; }
+  inline pzl_constexpr void operator-=(intmax_t o) { *this -= Integer{o}; }
+  inline pzl_constexpr void operator*=(intmax_t o) {
+    if (compat::isConstantEvaluated()) {
+      constantMultiplyInPlace(Integer{o}.slices, o >= 0);
+    } else {
+      multiplyInPlace(o);
+    }
+  }
 
 private:
-  Integer(std::vector<value_t> slices, bool positive)
+  // These work straight on the slices, see integer_gcd.cpp, integer_roots.cpp, integer_montgomery.cpp,
+  // integer_primes.cpp, integer_expressions.cpp and fixed_integer.h
+  friend Integer greatestCommonDivisor(Integer left, Integer right);
+  friend std::tuple<Integer, Integer, Integer> extendedGreatestCommonDivisor(const Integer &left,
+                                                                             const Integer &right);
+  friend Integer squareRoot(const Integer &value);
+  friend Integer nthRoot(const Integer &value, size_t degree);
+  friend bool isPerfectSquare(const Integer &value);
+  friend bool isPrime(const Integer &value);
+  template <typename Storage>
+  friend struct BasicMontgomeryContext;
+  template <size_t Bits>
+  friend struct FixedInteger;
+  friend Integer expressions::multiplyAdd(const Integer &left, const Integer &right, const Integer &addend,
+                                          bool subtract);
+  friend Integer expressions::multiplyAdd(const Integer &value, intmax_t multiplier, intmax_t addend, bool subtract);
+  friend void expressions::multiplyAddInPlace(Integer *value, intmax_t multiplier, intmax_t addend, bool subtract);
+  template <char... characters>
+  friend pzl_constexpr Integer literals::operator""_Z();
+
+  pzl_constexpr Integer(slices_t slices, bool positive)
       : slices(std::move(slices)), _positive(positive || this->slices.empty()) {}
 
-  std::vector<value_t> slices; // Low-endian base-10 storage
+  // Negating in unsigned arithmetic, since -INTMAX_MIN doesn't fit in an intmax_t
+  static inline constexpr uintmax_t magnitudeOf(intmax_t value) {
+    auto magnitude = static_cast<uintmax_t>(value);
+    return value < 0 ? 0 - magnitude : magnitude;
+  }
+
+  static inline constexpr compat::strong_ordering reversed(compat::strong_ordering ordering) {
+    if (ordering == compat::strong_ordering::less) return compat::strong_ordering::greater;
+    if (ordering == compat::strong_ordering::greater) return compat::strong_ordering::less;
+    return ordering;
+  }
+
+  // The runtime side of the constexpr operators, which goes through the kernels
+  [[nodiscard]] Integer add(const Integer &o) const;
+  [[nodiscard]] Integer add(intmax_t o) const;
+  [[nodiscard]] Integer subtract(const Integer &o) const;
+  [[nodiscard]] Integer subtract(intmax_t o) const;
+  [[nodiscard]] Integer multiply(const Integer &o) const;
+  [[nodiscard]] Integer multiply(intmax_t o) const;
+  [[nodiscard]] Integer exponentiate(const Integer &exponent) const;
+  void addInPlace(const slices_t &other, bool otherPositive);
+  void multiplyInPlace(const Integer &o);
+  void multiplyInPlace(intmax_t o);
+  [[nodiscard]] static compat::strong_ordering compareSlices(const slices_t &left, const slices_t &right);
+  [[nodiscard]] compat::strong_ordering compareToScalar(intmax_t o) const;
+
+  // And the constant evaluation side, see the bottom of this file
+  [[nodiscard]] static pzl_constexpr compat::strong_ordering compareMagnitudes(const slices_t &left,
+                                                                              const slices_t &right);
+  pzl_constexpr void constantAddInPlace(const slices_t &other, bool otherPositive);
+  pzl_constexpr void constantMultiplyInPlace(const slices_t &other, bool otherPositive);
+  pzl_constexpr void setConstantResult(const slices_t &result);
+  template <typename Operation>
+  [[nodiscard]] Integer bitwise(const Integer &o, Operation operation) const;
+
+  slices_t slices; // Low-endian base-2^32 storage
   bool _positive;
 };
+
+// These reuse the storage of whichever operand is a temporary, so chains like `a * b + c` only allocate for the product
+inline pzl_constexpr Integer operator+(Integer &&left, const Integer &right) {
+  left += right;
+  return std::move(left);
+}
+
+inline pzl_constexpr Integer operator+(const Integer &left, Integer &&right) {
+  right += left;
+  return std::move(right);
+}
+
+inline pzl_constexpr Integer operator+(Integer &&left, Integer &&right) {
+  left += right;
+  return std::move(left);
+}
+
+inline pzl_constexpr Integer operator-(Integer &&left, const Integer &right) {
+  left -= right;
+  return std::move(left);
+}
+
+inline pzl_constexpr Integer operator-(const Integer &left, Integer &&right) {
+  // left - right == -(right - left)
+  right -= left;
+  right *= -1;
+  return std::move(right);
+}
+
+inline pzl_constexpr Integer operator-(Integer &&left, Integer &&right) {
+  left -= right;
+  return std::move(left);
+}
+
+inline pzl_constexpr Integer operator*(Integer &&left, const Integer &right) {
+  left *= right;
+  return std::move(left);
+}
+
+inline pzl_constexpr Integer operator*(const Integer &left, Integer &&right) {
+  right *= left;
+  return std::move(right);
+}
+
+inline pzl_constexpr Integer operator*(Integer &&left, Integer &&right) {
+  left *= right;
+  return std::move(left);
+}
+
+inline pzl_constexpr Integer operator+(Integer &&left, intmax_t right) {
+  left += right;
+  return std::move(left);
+}
+
+inline pzl_constexpr Integer operator-(Integer &&left, intmax_t right) {
+  left -= right;
+  return std::move(left);
+}
+
+inline pzl_constexpr Integer operator*(Integer &&left, intmax_t right) {
+  left *= right;
+  return std::move(left);
+}
+
+// Constant evaluation can't reach the kernels, since they're compiled separately, so these are the plain versions of
+// them; they allocate more than they need to, but nobody's counting at compile time
+inline pzl_constexpr compat::strong_ordering Integer::compareMagnitudes(const slices_t &left, const slices_t &right) {
+  if (left.size() != right.size()) {
+    return left.size() < right.size() ? compat::strong_ordering::less : compat::strong_ordering::greater;
+  }
+
+  for (auto i = left.size(); i-- > 0;) {
+    if (left[i] != right[i]) {
+      return left[i] < right[i] ? compat::strong_ordering::less : compat::strong_ordering::greater;
+    }
+  }
+  return compat::strong_ordering::equal;
+}
+
+inline pzl_constexpr void Integer::constantAddInPlace(const slices_t &other, bool otherPositive) {
+  constexpr auto bits = std::numeric_limits<value_t>::digits;
+
+  if (other.empty()) return;
+
+  slices_t result;
+  if (_positive == otherPositive) {
+    result.resize(std::max(slices.size(), other.size()) + 1);
+    uint64_t carry = 0;
+    for (size_t i = 0; i < result.size(); ++i) {
+      auto sum = (i < slices.size() ? uint64_t{slices[i]} : 0) + (i < other.size() ? other[i] : 0) + carry;
+      result[i] = static_cast<value_t>(sum);
+      carry = sum >> bits;
+    }
+  } else {
+    auto otherIsBigger = compareMagnitudes(slices, other) == compat::strong_ordering::less;
+    const auto &bigger = otherIsBigger ? other : slices;
+    const auto &smaller = otherIsBigger ? slices : other;
+
+    result.resize(bigger.size());
+    uint64_t borrow = 0;
+    for (size_t i = 0; i < result.size(); ++i) {
+      auto subtrahend = (i < smaller.size() ? smaller[i] : 0) + borrow;
+      borrow = bigger[i] < subtrahend ? 1 : 0;
+      result[i] = static_cast<value_t>(bigger[i] - subtrahend);
+    }
+    if (otherIsBigger) _positive = otherPositive;
+  }
+
+  setConstantResult(result);
+}
+
+inline pzl_constexpr void Integer::constantMultiplyInPlace(const slices_t &other, bool otherPositive) {
+  constexpr auto bits = std::numeric_limits<value_t>::digits;
+
+  slices_t result(slices.size() + other.size(), 0);
+  for (size_t i = 0; i < slices.size(); ++i) {
+    uint64_t carry = 0;
+    for (size_t j = 0; j < other.size(); ++j) {
+      auto product = uint64_t{slices[i]} * other[j] + result[i + j] + carry;
+      result[i + j] = static_cast<value_t>(product);
+      carry = product >> bits;
+    }
+    result[i + other.size()] = static_cast<value_t>(carry);
+  }
+
+  _positive = _positive == otherPositive;
+  setConstantResult(result);
+}
+
+inline pzl_constexpr void Integer::setConstantResult(const slices_t &result) {
+  auto size = result.size();
+  while (size > 0 && result[size - 1] == 0) {
+    --size;
+  }
+
+  // A fresh copy rather than a move, so that whatever fits goes back inline, since only that can outlive the evaluation
+  slices = slices_t{result.data(), result.data() + size};
+  _positive = _positive || slices.empty();
+}
+
+namespace literals {
+
+template <size_t capacity>
+struct LiteralSlices {
+  std::array<Integer::value_t, capacity> slices{};
+  size_t size = 0;
+  bool valid = true;
+};
+
+// Works out the slices for the characters of an integer literal, in any of its bases, at compile time
+template <char... characters>
+constexpr auto parseLiteral() {
+  constexpr char text[] = {characters...};
+  constexpr auto length = sizeof...(characters);
+
+  uint64_t base = 10;
+  size_t first = 0;
+  if (length > 1 && text[0] == '0') {
+    auto prefix = text[1] | 0x20; // Lowercase
+    base = prefix == 'x' ? 16 : prefix == 'b' ? 2 : 8;
+    first = base == 8 ? 1 : 2;
+  }
+
+  // Hexadecimal digits carry the most bits, four per character, so there's at most one slice for every 8 of them
+  LiteralSlices<length / 8 + 1> result;
+  for (auto i = first; i < length; ++i) {
+    auto character = text[i];
+    if (character == '\'') continue; // Digit separator
+
+    auto lowercase = character | 0x20;
+    auto digit = character >= '0' && character <= '9'   ? static_cast<uint64_t>(character - '0')
+                 : lowercase >= 'a' && lowercase <= 'f' ? static_cast<uint64_t>(lowercase - 'a' + 10)
+                                                        : base;
+    if (digit >= base) {
+      result.valid = false; // Floating point literals end up here too
+      return result;
+    }
+
+    auto carry = digit;
+    for (size_t j = 0; j < result.size; ++j) {
+      auto value = result.slices[j] * base + carry;
+      result.slices[j] = static_cast<Integer::value_t>(value);
+      carry = value >> std::numeric_limits<Integer::value_t>::digits;
+    }
+    if (carry != 0) result.slices[result.size++] = static_cast<Integer::value_t>(carry);
+  }
+  return result;
+}
+
+// e.g. 123456789012345678901234567890_Z or 0xFFFF'FFFF'FFFF'FFFF'FFFF_Z; the digits are parsed at compile time, so all
+// that's left for runtime is copying the slices over, and anything up to 128 bits can be a constexpr Integer
+template <char... characters>
+pzl_constexpr Integer operator""_Z() {
+  constexpr auto literal = parseLiteral<characters...>();
+  static_assert(literal.valid, "Only integer literals can be Integers");
+  return Integer{Integer::slices_t{literal.slices.data(), literal.slices.data() + literal.size}, true};
+}
+}
 }
 
 namespace std { // NOLINT(cert-dcl58-cpp)
@@ -101,6 +519,10 @@ inline pzl::Integer abs(const pzl::Integer &integer) {
   return integer.absolute();
 }
 
+inline pzl::Integer abs(pzl::Integer &&integer) {
+  return std::move(integer).absolute();
+}
+
 inline pzl::Integer pow(const pzl::Integer &base, const pzl::Integer &exponent) {
   return base.power(exponent);
 }
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2026 Emanuel Machado da Silva
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "integers.h"
+
+#include "common/assertions.h" // ensure
+
+#include <cstddef> // size_t
+#include <cstdint> // intmax_t, uintmax_t
+#include <limits>  // std::numeric_limits
+#include <utility> // std::move
+#include <vector>  // std::vector
+
+using pzl::Integer;
+
+namespace {
+
+// When k is this many times smaller than n, sieving every prime up to n costs more than dividing the product of the
+// top k numbers by k!
+constexpr size_t SMALL_BINOMIAL_RATIO = 64;
+
+struct PrimePower {
+  size_t prime;
+  size_t exponent;
+};
+
+// Sieve of Eratosthenes, only over the odd numbers
+std::vector<size_t> oddPrimesUpTo(size_t limit) {
+  std::vector<size_t> primes;
+  if (limit < 3) return primes;
+
+  // composite[i] is for 2i + 1
+  std::vector<bool> composite((limit - 1) / 2 + 1, false);
+  for (size_t i = 1; i < composite.size(); ++i) {
+    if (composite[i]) continue;
+
+    auto prime = 2 * i + 1;
+    primes.push_back(prime);
+    for (auto multiple = prime * prime; multiple <= limit; multiple += 2 * prime) {
+      composite[multiple / 2] = true;
+    }
+  }
+  return primes;
+}
+
+// Legendre's formula, how many times `prime` divides n!
+size_t factorialExponent(size_t n, size_t prime) {
+  size_t exponent = 0;
+  while (n > 0) {
+    n /= prime;
+    exponent += n;
+  }
+  return exponent;
+}
+
+// Multiplies the values in pairs, then the pairs in pairs, and so on, so the big multiplications get operands of about
+// the same size, which is where the fast multiplication algorithms pay off, unlike a long chain of big-by-small ones
+Integer product(const std::vector<Integer> &values, size_t begin, size_t end) {
+  if (end - begin == 1) return values[begin];
+
+  auto middle = begin + (end - begin) / 2;
+  return product(values, begin, middle) * product(values, middle, end);
+}
+
+Integer product(const std::vector<uintmax_t> &values) {
+  // Packing as many values as we can into each leaf saves a lot of tiny multiplications at the bottom of the tree
+  constexpr auto leafMax = static_cast<uintmax_t>(std::numeric_limits<intmax_t>::max());
+
+  std::vector<Integer> leaves;
+  uintmax_t leaf = 1;
+  for (auto value : values) {
+    ensure(value > 0 && value <= leafMax);
+    if (leaf > leafMax / value) {
+      leaves.emplace_back(static_cast<intmax_t>(leaf));
+      leaf = 1;
+    }
+    leaf *= value;
+  }
+  leaves.emplace_back(static_cast<intmax_t>(leaf));
+
+  return product(leaves, 0, leaves.size());
+}
+
+// Goes through the bits of the exponents from the top down, squaring as it goes, so each prime only gets multiplied in
+// once per set bit, and the squarings are all balanced
+Integer productOfPowers(const std::vector<PrimePower> &powers, size_t powerOfTwo) {
+  size_t bits = 0;
+  for (const auto &power : powers) {
+    while ((power.exponent >> bits) > 0) {
+      ++bits;
+    }
+  }
+
+  Integer result{1};
+  std::vector<uintmax_t> factors;
+  for (auto bit = bits; bit-- > 0;) {
+    result *= result;
+
+    factors.clear();
+    for (const auto &power : powers) {
+      if ((power.exponent >> bit) & 1) factors.push_back(power.prime);
+    }
+    if (!factors.empty()) result *= product(factors);
+  }
+
+  result <<= powerOfTwo;
+  return result;
+}
+}
+
+Integer pzl::factorial(size_t n) {
+  std::vector<PrimePower> powers;
+  for (auto prime : oddPrimesUpTo(n)) {
+    powers.push_back(PrimePower{prime, factorialExponent(n, prime)});
+  }
+  return productOfPowers(powers, factorialExponent(n, 2));
+}
+
+Integer pzl::binomial(size_t n, size_t k) {
+  if (k > n) return Integer{0};
+  if (k > n - k) k = n - k;
+  if (k == 0) return Integer{1};
+
+  if (k < n / SMALL_BINOMIAL_RATIO) {
+    std::vector<uintmax_t> top;
+    for (auto i = n - k + 1; i <= n; ++i) {
+      top.push_back(i);
+    }
+    return product(top) / factorial(k);
+  }
+
+  // Kummer's theorem, or just Legendre's formula on n! / (k! * (n - k)!)
+  std::vector<PrimePower> powers;
+  for (auto prime : oddPrimesUpTo(n)) {
+    auto exponent = factorialExponent(n, prime) - factorialExponent(k, prime) - factorialExponent(n - k, prime);
+    if (exponent > 0) powers.push_back(PrimePower{prime, exponent});
+  }
+  auto powerOfTwo = factorialExponent(n, 2) - factorialExponent(k, 2) - factorialExponent(n - k, 2);
+  return productOfPowers(powers, powerOfTwo);
+}
@@ -0,0 +1,279 @@
+/*
+ * Copyright (c) 2026 Emanuel Machado da Silva
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "integer_kernels.h"
+
+#include "common/assertions.h"   // ensure
+#include "common/small_vector.h" // Puzzles::SmallVector
+
+#include <algorithm> // std::all_of, std::copy, std::fill, std::min
+#include <utility>   // std::move
+#include <vector>    // std::vector
+
+using pzl::kernels::SlicesView;
+using pzl::kernels::value_t;
+using pzl::kernels::wide_t;
+
+using Slices = std::vector<value_t>;
+// Algorithm D's working copies; dividends up to 512 bits, plus the slice normalizing them adds, don't need the heap
+using Scratch = Puzzles::SmallVector<value_t, 17>;
+
+namespace {
+
+// Below this size (in slices) a reciprocal is cheaper to find with Algorithm D than with Newton's iteration
+constexpr size_t newtonThreshold = 128;
+
+Slices product(SlicesView left, SlicesView right) {
+  Slices result(left.size + right.size);
+  pzl::kernels::multiply(left, right, result.data());
+  pzl::kernels::trim(&result);
+  return result;
+}
+
+void divideKnuth(SlicesView dividend, SlicesView divisor, value_t *quotient, value_t *remainder) {
+  using namespace pzl::kernels;
+
+  auto n = divisor.size;
+  auto m = dividend.size - n;
+
+  // Knuth's Algorithm D (TAOCP vol. 2, 4.3.1)
+  // D1: Normalize, so the divisor's top slice is at least SLICE_SIZE / 2 and each estimate is off by 2 at most
+  auto scale = static_cast<value_t>(SLICE_SIZE / (wide_t{divisor.data[n - 1]} + 1));
+
+  Scratch u(dividend.data, dividend.data + dividend.size);
+  u.push_back(multiplyBySlice(u.data(), u.size(), scale));
+
+  Scratch v(divisor.data, divisor.data + divisor.size);
+  auto overflow = multiplyBySlice(v.data(), v.size(), scale);
+  ensure(overflow == 0);
+
+  const wide_t vTop = v[n - 1], vNext = v[n - 2];
+
+  // D2-D7: Calculate each slice of the quotient, from the top down
+  for (auto j = m + 1; j-- > 0;) {
+    // D3: Estimate the quotient slice from the top two slices, then correct it using the third one
+    wide_t numerator = wide_t{u[j + n]} * SLICE_SIZE + u[j + n - 1];
+    wide_t estimate = numerator / vTop;
+    wide_t estimateRemainder = numerator % vTop;
+
+    while (estimate >= SLICE_SIZE || estimate * vNext > estimateRemainder * SLICE_SIZE + u[j + n - 2]) {
+      --estimate;
+      estimateRemainder += vTop;
+      if (estimateRemainder >= SLICE_SIZE) break;
+    }
+
+    // D4: Multiply and subtract
+    wide_t carry = 0, borrow = 0;
+    for (size_t i = 0; i < n; ++i) {
+      wide_t product = estimate * v[i] + carry;
+      carry = product / SLICE_SIZE;
+      wide_t subtrahend = product % SLICE_SIZE + borrow;
+      borrow = u[i + j] < subtrahend;
+      u[i + j] = static_cast<value_t>(borrow ? u[i + j] + SLICE_SIZE - subtrahend : u[i + j] - subtrahend);
+    }
+    wide_t subtrahend = carry + borrow;
+    borrow = u[j + n] < subtrahend;
+    u[j + n] = static_cast<value_t>(borrow ? u[j + n] + SLICE_SIZE - subtrahend : u[j + n] - subtrahend);
+
+    // D5-D6: The estimate was still one too big (this is rare), so add the divisor back
+    if (borrow) {
+      --estimate;
+      addInto(u.data() + j, n + 1, SlicesView{v.data(), v.size()});
+    }
+
+    if (quotient) quotient[j] = static_cast<value_t>(estimate);
+  }
+
+  // D8: Unnormalize the remainder
+  if (remainder) {
+    divideBySlice(u.data(), n, scale);
+    std::copy(u.cbegin(), u.cbegin() + n, remainder);
+  }
+}
+
+// Returns floor((B^2n - 1) / divisor), B being SLICE_SIZE, for a divisor of n slices whose top bit is set
+// The result always has n + 1 slices
+Slices reciprocal(SlicesView divisor) {
+  using namespace pzl::kernels;
+
+  auto n = divisor.size;
+  if (n < newtonThreshold) {
+    Slices numerator(2 * n, SLICE_MAX);
+    Slices result(n + 1);
+    divideKnuth(numerator, divisor, result.data(), nullptr);
+    return result;
+  }
+
+  // Each Newton step doubles the precision, so start from the reciprocal of the divisor's top half (plus a couple of
+  // slices, to keep the error down to a few units), and shift it into place
+  auto low = n - (n / 2 + 2);
+  auto approximation = reciprocal(divisor.subview(low, n - low));
+  Slices x(low, 0);
+  x.insert(x.end(), approximation.cbegin(), approximation.cend());
+
+  // x += x * (B^2n - divisor * x) / B^2n, where the residual can be negative
+  Slices power(2 * n + 1, 0);
+  power.back() = 1;
+
+  auto residual = product(divisor, x);
+  auto overshot = compare(residual, power) == compat::strong_ordering::greater;
+  if (overshot) {
+    subtractFrom(residual.data(), residual.size(), power);
+  } else {
+    subtractFrom(power.data(), power.size(), residual);
+    residual = std::move(power);
+  }
+  trim(&residual);
+
+  auto correction = product(x, residual);
+  auto scaledCorrection = SlicesView{correction}.subview(2 * n, correction.size());
+  x.push_back(0);
+  if (overshot) {
+    subtractFrom(x.data(), x.size(), scaledCorrection);
+  } else {
+    addInto(x.data(), x.size(), scaledCorrection);
+  }
+
+  // Now it's only off by a few units
+  const Slices one{1};
+  auto check = product(divisor, x);
+  while (check.size() > 2 * n) {
+    subtractFrom(x.data(), x.size(), one);
+    subtractFrom(check.data(), check.size(), divisor);
+    trim(&check);
+  }
+
+  Slices rest(2 * n, SLICE_MAX);
+  subtractFrom(rest.data(), rest.size(), check);
+  trim(&rest);
+  while (compare(rest, divisor) != compat::strong_ordering::less) {
+    addInto(x.data(), x.size(), one);
+    subtractFrom(rest.data(), rest.size(), divisor);
+    trim(&rest);
+  }
+
+  x.resize(n + 1);
+  return x;
+}
+}
+
+pzl::kernels::ReciprocalDivisor::ReciprocalDivisor(SlicesView divisor) {
+  ensure(!divisor.empty() && divisor.data[divisor.size - 1] != 0);
+
+  // Normalize, the same way Algorithm D does
+  scale = static_cast<value_t>(SLICE_SIZE / (wide_t{divisor.data[divisor.size - 1]} + 1));
+
+  normalized.assign(divisor.data, divisor.data + divisor.size);
+  auto overflow = multiplyBySlice(normalized.data(), normalized.size(), scale);
+  ensure(overflow == 0);
+
+  reciprocal = ::reciprocal(normalized);
+}
+
+// Long division where each "digit" is as long as the divisor, and each of them is found by multiplying with the
+// divisor's reciprocal (see Modern Computer Arithmetic, 2.4.1 and 3.4)
+void pzl::kernels::divide(SlicesView dividend, const ReciprocalDivisor &divisor, value_t *quotient,
+                          value_t *remainder) {
+  ensure(dividend.size >= divisor.size());
+
+  const auto &v = divisor.normalized;
+  auto n = v.size();
+  auto m = dividend.size - n;
+
+  Slices u(dividend.data, dividend.data + dividend.size);
+  u.push_back(multiplyBySlice(u.data(), u.size(), divisor.scale));
+
+  // Each step divides (rest * B^n + block) by v, which is smaller than B^2n because rest < v
+  const Slices one{1};
+  Slices fullQuotient(u.size(), 0);
+  Slices rest;
+  for (auto block = (u.size() + n - 1) / n; block-- > 0;) {
+    auto offset = static_cast<std::ptrdiff_t>(block * n);
+    auto end = static_cast<std::ptrdiff_t>(std::min((block + 1) * n, u.size()));
+    Slices current(u.cbegin() + offset, u.cbegin() + end);
+    current.resize(n, 0);
+    current.insert(current.end(), rest.cbegin(), rest.cend());
+    trim(&current);
+
+    // Since the reciprocal is rounded down, this estimate is a couple of units too small at most
+    auto estimate = product(current, divisor.reciprocal);
+    auto top = SlicesView{estimate}.subview(2 * n, estimate.size());
+    Slices digit(top.data, top.data + top.size);
+
+    auto subtrahend = product(digit, v);
+    subtractFrom(current.data(), current.size(), subtrahend);
+    trim(&current);
+
+    digit.push_back(0);
+    while (compare(current, v) != compat::strong_ordering::less) {
+      subtractFrom(current.data(), current.size(), v);
+      trim(&current);
+      addInto(digit.data(), digit.size(), one);
+    }
+
+    trim(&digit);
+    ensure(digit.size() <= n);
+    std::copy(digit.cbegin(), digit.cend(), fullQuotient.begin() + offset);
+    rest = std::move(current);
+  }
+
+  if (quotient) {
+    ensure(std::all_of(fullQuotient.cbegin() + static_cast<std::ptrdiff_t>(m + 1), fullQuotient.cend(),
+                       [](auto slice) { return slice == 0; }));
+    std::copy(fullQuotient.cbegin(), fullQuotient.cbegin() + static_cast<std::ptrdiff_t>(m + 1), quotient);
+  }
+
+  // Unnormalize the remainder
+  if (remainder) {
+    rest.resize(n, 0);
+    divideBySlice(rest.data(), n, divisor.scale);
+    std::copy(rest.cbegin(), rest.cend(), remainder);
+  }
+}
+
+void pzl::kernels::divide(SlicesView dividend, SlicesView divisor, value_t *quotient, value_t *remainder) {
+  ensure(!divisor.empty() && divisor.data[divisor.size - 1] != 0);
+  ensure(dividend.size >= divisor.size);
+
+  auto n = divisor.size;
+  auto m = dividend.size - n;
+
+  if (n == 1) {
+    wide_t rest = 0;
+    if (quotient) {
+      std::copy(dividend.data, dividend.data + dividend.size, quotient);
+      rest = divideBySlice(quotient, dividend.size, divisor.data[0]);
+    } else {
+      for (auto i = dividend.size; i-- > 0;) {
+        rest = ((rest << SLICE_BITS) | dividend.data[i]) % divisor.data[0];
+      }
+    }
+    if (remainder) remainder[0] = static_cast<value_t>(rest);
+    return;
+  }
+
+  if (n < RECIPROCAL_DIVISION_THRESHOLD || m < RECIPROCAL_DIVISION_THRESHOLD) {
+    divideKnuth(dividend, divisor, quotient, remainder);
+  } else {
+    divide(dividend, ReciprocalDivisor{divisor}, quotient, remainder);
+  }
+}
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026 Emanuel Machado da Silva
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "integer_expressions.h"
+#include "integer_kernels.h"
+
+#include <algorithm> // std::max
+#include <utility>   // std::move
+
+using pzl::Integer;
+using pzl::kernels::SLICE_MAX;
+using pzl::kernels::slices_t;
+using pzl::kernels::value_t;
+
+Integer pzl::expressions::multiplyAdd(const Integer &left, const Integer &right, const Integer &addend,
+                                      bool subtract) {
+  auto addendPositive = addend._positive != subtract;
+  if (left.slices.empty() || right.slices.empty()) return Integer{addend.slices, addendPositive};
+
+  // With room for the sum up front, adding the addend in won't have to grow the slices again; unless it might still
+  // fit inline, once the product is trimmed
+  auto size = left.slices.size() + right.slices.size();
+  auto capacity = std::max(size, addend.slices.size()) + 1;
+  slices_t slices;
+  if (capacity > slices_t::inlineCapacity + 1) slices.reserve(capacity);
+  if (left.slices.size() == 1 || right.slices.size() == 1) {
+    const auto &longer = left.slices.size() == 1 ? right.slices : left.slices;
+    auto multiplier = left.slices.size() == 1 ? left.slices[0] : right.slices[0];
+    slices.resize(longer.size() + 1);
+    slices.back() = kernels::multiplyAddBySlice(longer.data(), longer.size(), multiplier, 0, slices.data());
+  } else {
+    slices.resize(size);
+    kernels::multiply(left.slices, right.slices, slices.data());
+  }
+  kernels::trim(&slices);
+
+  Integer result{std::move(slices), left._positive == right._positive};
+  result.addInPlace(addend.slices, addendPositive);
+  return result;
+}
+
+Integer pzl::expressions::multiplyAdd(const Integer &value, intmax_t multiplier, intmax_t addend, bool subtract) {
+  auto multiplierMagnitude = Integer::magnitudeOf(multiplier);
+  auto addendMagnitude = Integer::magnitudeOf(addend);
+  if (value.slices.empty() || multiplier == 0 || multiplierMagnitude > SLICE_MAX || addendMagnitude > SLICE_MAX) {
+    auto result = value;
+    multiplyAddInPlace(&result, multiplier, addend, subtract);
+    return result;
+  }
+
+  // When the signs disagree, the addend comes out of the product afterwards, which takes a single slice, most times
+  auto productPositive = value._positive == (multiplier > 0);
+  auto addendPositive = (addend >= 0) != subtract;
+  auto sameSign = addend == 0 || productPositive == addendPositive;
+
+  // Straight from value's slices into the result's, instead of copying them first and then going over them again
+  auto size = value.slices.size();
+  slices_t slices(size + 1);
+  slices[size] = kernels::multiplyAddBySlice(value.slices.data(), size, static_cast<value_t>(multiplierMagnitude),
+                                             sameSign ? static_cast<value_t>(addendMagnitude) : 0, slices.data());
+  kernels::trim(&slices);
+
+  Integer result{std::move(slices), productPositive};
+  if (!sameSign) result.addInPlace(slices_t{static_cast<value_t>(addendMagnitude)}, addendPositive);
+  return result;
+}
+
+void pzl::expressions::multiplyAddInPlace(Integer *value, intmax_t multiplier, intmax_t addend, bool subtract) {
+  auto multiplierMagnitude = Integer::magnitudeOf(multiplier);
+  auto addendMagnitude = Integer::magnitudeOf(addend);
+  if (value->slices.empty() || multiplier == 0 || multiplierMagnitude > SLICE_MAX || addendMagnitude > SLICE_MAX) {
+    // None of these are worth a kernel of their own
+    *value *= multiplier;
+    if (subtract) {
+      *value -= addend;
+    } else {
+      *value += addend;
+    }
+    return;
+  }
+
+  auto productPositive = value->_positive == (multiplier > 0);
+  auto addendPositive = (addend >= 0) != subtract;
+  auto sameSign = addend == 0 || productPositive == addendPositive;
+
+  auto size = value->slices.size();
+  value->slices.resize(size + 1);
+  value->slices[size] =
+      kernels::multiplyAddBySlice(value->slices.data(), size, static_cast<value_t>(multiplierMagnitude),
+                                  sameSign ? static_cast<value_t>(addendMagnitude) : 0, value->slices.data());
+  kernels::trim(&value->slices);
+  value->_positive = productPositive;
+
+  if (!sameSign) value->addInPlace(slices_t{static_cast<value_t>(addendMagnitude)}, addendPositive);
+}
@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2026 Emanuel Machado da Silva
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "common/numbers/integer.h"
+
+#include <cstdint>     // intmax_t
+#include <type_traits> // std::decay_t, std::enable_if_t, std::false_type, std::true_type
+#include <utility>     // std::move
+
+// Opt-in lazy arithmetic for Integers: wrapping an operand in lazy() makes +, - and * build up the expression instead
+// of working it out, which only happens once it's turned into an Integer; that lets the common shapes run as fused
+// kernels, with a single allocation for the result:
+// - a * b + c (and a * b - c, c + a * b, c - a * b) multiplies straight into a result with room for the sum
+// - a * m + n, with m and n scalars that fit in a slice, takes a single pass over a's slices, and none at all when a is
+//   a temporary handed to lazy(), since it's worked out in place
+// Everything else works out left to right, in place on the running result
+// lvalues are only referenced, so, same as with string_views, the expression must be evaluated before they go away,
+// which is why they're meant to be written and turned into an Integer in one go, e.g.:
+//   Integer next = lazy(previous) * 2 + 1;
+namespace pzl::expressions {
+
+// See integer_expressions.cpp
+Integer multiplyAdd(const Integer &left, const Integer &right, const Integer &addend, bool subtract);
+Integer multiplyAdd(const Integer &value, intmax_t multiplier, intmax_t addend, bool subtract);
+void multiplyAddInPlace(Integer *value, intmax_t multiplier, intmax_t addend, bool subtract);
+
+struct Reference {
+  const Integer &value;
+};
+
+struct Value {
+  Integer value;
+};
+
+struct Scalar {
+  intmax_t value;
+};
+
+// `operation` is one of '+', '-' or '*'
+template <char operation, typename Left, typename Right>
+struct Node {
+  Left left;
+  Right right;
+
+  operator Integer() && { return evaluate(std::move(*this)); } // NOLINT(google-explicit-constructor)
+};
+
+[[nodiscard]] inline Reference lazy(const Integer &value) {
+  return Reference{value};
+}
+
+[[nodiscard]] inline Value lazy(Integer &&value) {
+  return Value{std::move(value)};
+}
+
+template <typename T>
+struct IsExpression : std::false_type {};
+template <>
+struct IsExpression<Reference> : std::true_type {};
+template <>
+struct IsExpression<Value> : std::true_type {};
+template <char operation, typename Left, typename Right>
+struct IsExpression<Node<operation, Left, Right>> : std::true_type {};
+
+template <typename T>
+struct IsProduct : std::false_type {};
+template <typename Left, typename Right>
+struct IsProduct<Node<'*', Left, Right>> : std::true_type {};
+
+template <typename Left, typename Right>
+using BothExpressions = std::enable_if_t<IsExpression<Left>::value && IsExpression<Right>::value, bool>;
+template <typename Expression>
+using AnExpression = std::enable_if_t<IsExpression<Expression>::value, bool>;
+
+// Scalars always go on the right, so the fused kernels only have to look for them there
+template <typename Left, typename Right, BothExpressions<Left, Right> = true>
+[[nodiscard]] inline Node<'+', Left, Right> operator+(Left left, Right right) {
+  return {std::move(left), std::move(right)};
+}
+template <typename Left, typename Right, BothExpressions<Left, Right> = true>
+[[nodiscard]] inline Node<'-', Left, Right> operator-(Left left, Right right) {
+  return {std::move(left), std::move(right)};
+}
+template <typename Left, typename Right, BothExpressions<Left, Right> = true>
+[[nodiscard]] inline Node<'*', Left, Right> operator*(Left left, Right right) {
+  return {std::move(left), std::move(right)};
+}
+
+template <typename Expression, AnExpression<Expression> = true>
+[[nodiscard]] inline Node<'+', Expression, Scalar> operator+(Expression left, intmax_t right) {
+  return {std::move(left), Scalar{right}};
+}
+template <typename Expression, AnExpression<Expression> = true>
+[[nodiscard]] inline Node<'-', Expression, Scalar> operator-(Expression left, intmax_t right) {
+  return {std::move(left), Scalar{right}};
+}
+template <typename Expression, AnExpression<Expression> = true>
+[[nodiscard]] inline Node<'*', Expression, Scalar> operator*(Expression left, intmax_t right) {
+  return {std::move(left), Scalar{right}};
+}
+
+template <typename Expression, AnExpression<Expression> = true>
+[[nodiscard]] inline Node<'+', Expression, Scalar> operator+(intmax_t left, Expression right) {
+  return {std::move(right), Scalar{left}};
+}
+template <typename Expression, AnExpression<Expression> = true>
+[[nodiscard]] inline Node<'-', Scalar, Expression> operator-(intmax_t left, Expression right) {
+  return {Scalar{left}, std::move(right)};
+}
+template <typename Expression, AnExpression<Expression> = true>
+[[nodiscard]] inline Node<'*', Expression, Scalar> operator*(intmax_t left, Expression right) {
+  return {std::move(right), Scalar{left}};
+}
+
+template <typename Expression>
+Integer evaluate(Expression &&expression);
+
+// What the Integer operators take for each part: references stay references and scalars stay scalars, so nothing gets
+// copied, and everything else is worked out into a temporary
+template <typename Expression>
+decltype(auto) operand(Expression &&expression) {
+  using Type = std::decay_t<Expression>;
+  if constexpr (std::is_same_v<Type, Reference>) {
+    return static_cast<const Integer &>(expression.value);
+  } else if constexpr (std::is_same_v<Type, Scalar>) {
+    return expression.value;
+  } else {
+    return evaluate(std::move(expression));
+  }
+}
+
+// Same as operand, for the kernels that only take Integers
+template <typename Expression>
+decltype(auto) integerOperand(Expression &&expression) {
+  if constexpr (std::is_same_v<std::decay_t<Expression>, Reference>) {
+    return static_cast<const Integer &>(expression.value);
+  } else {
+    return evaluate(std::move(expression));
+  }
+}
+
+// product +/- addend, where product is a Node<'*', ...>
+template <typename Product, typename Addend>
+Integer evaluateMultiplyAdd(Product &&product, Addend &&addend, bool subtract) {
+  using Left = decltype(product.left);
+  using Right = decltype(product.right);
+
+  if constexpr (std::is_same_v<Right, Scalar> && std::is_same_v<std::decay_t<Addend>, Scalar>) {
+    if constexpr (std::is_same_v<Left, Reference>) {
+      return multiplyAdd(product.left.value, product.right.value, addend.value, subtract);
+    } else {
+      auto result = evaluate(std::move(product.left));
+      multiplyAddInPlace(&result, product.right.value, addend.value, subtract);
+      return result;
+    }
+  } else {
+    return multiplyAdd(integerOperand(std::move(product.left)), integerOperand(std::move(product.right)),
+                       integerOperand(std::move(addend)), subtract);
+  }
+}
+
+// Takes its expression apart, so it expects an rvalue
+template <typename Expression>
+Integer evaluate(Expression &&expression) {
+  using Type = std::decay_t<Expression>;
+  if constexpr (std::is_same_v<Type, Reference>) {
+    return expression.value;
+  } else if constexpr (std::is_same_v<Type, Value>) {
+    return std::move(expression.value);
+  } else if constexpr (std::is_same_v<Type, Scalar>) {
+    return Integer{expression.value};
+  } else {
+    using Left = decltype(expression.left);
+    using Right = decltype(expression.right);
+    constexpr auto subtract = std::is_same_v<Type, Node<'-', Left, Right>>;
+
+    if constexpr (IsProduct<Type>::value) {
+      auto result = evaluate(std::move(expression.left));
+      result *= operand(std::move(expression.right));
+      return result;
+    } else if constexpr (IsProduct<Left>::value) {
+      return evaluateMultiplyAdd(std::move(expression.left), std::move(expression.right), subtract);
+    } else if constexpr (IsProduct<Right>::value) {
+      // c - a * b is -(a * b - c), and negating a temporary costs nothing
+      auto result = evaluateMultiplyAdd(std::move(expression.right), std::move(expression.left), subtract);
+      if constexpr (subtract) return -std::move(result);
+      return result;
+    } else {
+      auto result = evaluate(std::move(expression.left));
+      if constexpr (subtract) {
+        result -= operand(std::move(expression.right));
+      } else {
+        result += operand(std::move(expression.right));
+      }
+      return result;
+    }
+  }
+}
+}
@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2026 Emanuel Machado da Silva
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "integers.h"
+#include "integer_kernels.h"
+
+#include "common/assertions.h" // ensure
+
+#include <bit>     // std::countr_zero
+#include <cstdint> // int64_t, uint64_t
+#include <utility> // std::move, std::swap
+
+using pzl::Integer;
+using pzl::kernels::SLICE_BITS;
+using pzl::kernels::slices_t;
+using pzl::kernels::SlicesView;
+using pzl::kernels::value_t;
+
+namespace {
+
+// Lehmer's steps run on this many of the leading bits, which leaves enough headroom for the cofactors to never
+// overflow an int64_t
+constexpr size_t LEADING_BITS = 60;
+
+// The matrix that takes (a, b) to (a * a' + b * b', a * c' + b * d'), after a run of Euclid's steps
+struct Cofactors {
+  int64_t a = 1, b = 0, c = 0, d = 1;
+};
+
+// The 64 bits starting at bit `shift`
+uint64_t bitsFrom(const slices_t &slices, size_t shift) {
+  auto sliceAt = [&slices](size_t i) { return i < slices.size() ? uint64_t{slices[i]} : 0; };
+
+  auto first = shift / SLICE_BITS;
+  auto offset = shift % SLICE_BITS;
+
+  auto low = (sliceAt(first + 1) << SLICE_BITS) | sliceAt(first);
+  if (offset == 0) return low;
+  return (low >> offset) | (sliceAt(first + 2) << (2 * SLICE_BITS - offset));
+}
+
+uint64_t toWord(const slices_t &slices) {
+  ensure(slices.size() <= 2);
+  uint64_t result = 0;
+  for (size_t i = slices.size(); i-- > 0;) {
+    result = (result << SLICE_BITS) | slices[i];
+  }
+  return result;
+}
+
+slices_t fromWord(uint64_t word) {
+  slices_t result{static_cast<value_t>(word), static_cast<value_t>(word >> SLICE_BITS)};
+  pzl::kernels::trim(&result);
+  return result;
+}
+
+// Knuth's Algorithm L, steps L2 and L3 (TAOCP vol. 2, 4.5.2): runs Euclid's algorithm on the leading bits alone, for
+// as long as the quotients are guaranteed to be the same ones the whole numbers would get
+Cofactors lehmerSteps(int64_t x, int64_t y) {
+  Cofactors m;
+  while (y + m.c > 0 && y + m.d > 0) {
+    auto quotient = (x + m.a) / (y + m.c);
+    if (quotient != (x + m.b) / (y + m.d)) break;
+
+    m = {m.c, m.d, m.a - quotient * m.c, m.b - quotient * m.d};
+    auto next = x - quotient * y;
+    x = y;
+    y = next;
+  }
+  return m;
+}
+
+// left * |leftFactor| - right * |rightFactor|, or the other way around, whichever one isn't negative
+// After any of Lehmer's steps the factors have opposite signs (or one of them is zero)
+slices_t combine(const slices_t &left, int64_t leftFactor, const slices_t &right, int64_t rightFactor) {
+  auto scaled = [](const slices_t &slices, int64_t factor) {
+    auto magnitude = static_cast<uint64_t>(factor < 0 ? -factor : factor);
+    auto multiplier = fromWord(magnitude);
+
+    slices_t result(slices.size() + multiplier.size());
+    pzl::kernels::multiply(slices, multiplier, result.data());
+    pzl::kernels::trim(&result);
+    return result;
+  };
+
+  auto positive = scaled(left, leftFactor);
+  auto negative = scaled(right, rightFactor);
+  if (leftFactor <= 0) std::swap(positive, negative);
+
+  pzl::kernels::subtractFrom(positive.data(), positive.size(), negative);
+  pzl::kernels::trim(&positive);
+  return positive;
+}
+
+// (a, b) becomes (b, a % b), handing the quotient to `track` if it wants it
+template <typename Track>
+void euclidStep(slices_t *a, slices_t *b, Track *track) {
+  slices_t remainder(b->size());
+  if constexpr (Track::wantsQuotients()) {
+    slices_t quotient(a->size() - b->size() + 1);
+    pzl::kernels::divide(*a, *b, quotient.data(), remainder.data());
+    pzl::kernels::trim(&quotient);
+    track->quotient(std::move(quotient));
+  } else {
+    pzl::kernels::divide(*a, *b, nullptr, remainder.data());
+  }
+  pzl::kernels::trim(&remainder);
+
+  *a = std::move(*b);
+  *b = std::move(remainder);
+}
+
+uint64_t binaryGcd(uint64_t a, uint64_t b) {
+  if (a == 0) return b;
+  if (b == 0) return a;
+
+  // Stein's algorithm, the common powers of two get put back at the end
+  auto shift = std::countr_zero(a | b);
+  a >>= std::countr_zero(a);
+  do {
+    b >>= std::countr_zero(b);
+    if (a > b) std::swap(a, b);
+    b -= a;
+  } while (b != 0);
+
+  return a << shift;
+}
+
+// Lehmer's algorithm, for a >= b, using single-word steps while the numbers are big and binary GCD once they fit in a
+// word; `track` is told about every step, so it can follow the Bezout coefficients along
+template <typename Track>
+slices_t lehmer(slices_t a, slices_t b, Track *track) {
+  while (b.size() > 2) {
+    // The leading bits can't tell us anything about the quotient when the sizes are too far apart
+    if (a.size() > b.size() + 1) {
+      euclidStep(&a, &b, track);
+      continue;
+    }
+
+    auto shift = pzl::kernels::bitLength(a) - LEADING_BITS;
+    auto m = lehmerSteps(static_cast<int64_t>(bitsFrom(a, shift)), static_cast<int64_t>(bitsFrom(b, shift)));
+    if (m.b == 0) {
+      // Not even the first quotient was certain, which means it's a big one
+      euclidStep(&a, &b, track);
+      continue;
+    }
+
+    auto nextA = combine(a, m.a, b, m.b);
+    b = combine(a, m.c, b, m.d);
+    a = std::move(nextA);
+    track->cofactors(m);
+  }
+
+  if (b.empty()) return a;
+
+  // Now a single division brings both of them down to a word
+  euclidStep(&a, &b, track);
+  auto x = toWord(a), y = toWord(b);
+
+  if constexpr (Track::wantsQuotients()) {
+    while (y != 0) {
+      track->quotient(fromWord(x / y));
+      auto next = x % y;
+      x = y;
+      y = next;
+    }
+    return fromWord(x);
+  } else {
+    return fromWord(binaryGcd(x, y));
+  }
+}
+
+struct NoTracking {
+  static constexpr bool wantsQuotients() { return false; }
+  void cofactors(const Cofactors &) {}
+};
+}
+
+Integer pzl::greatestCommonDivisor(Integer left, Integer right) {
+  if (kernels::compare(left.slices, right.slices) == compat::strong_ordering::less) std::swap(left, right);
+
+  NoTracking tracking;
+  return Integer{lehmer(std::move(left.slices), std::move(right.slices), &tracking), true};
+}
+
+std::tuple<Integer, Integer, Integer> pzl::extendedGreatestCommonDivisor(const Integer &left, const Integer &right) {
+  if (right == 0) return {left.absolute(), Integer{left.positive() ? 1 : -1}, Integer{0}};
+  if (left == 0) return {right.absolute(), Integer{0}, Integer{right.positive() ? 1 : -1}};
+
+  // Follows the coefficient of |left| for both a and b, which is enough to work out the other one at the end
+  struct Coefficients {
+    static constexpr bool wantsQuotients() { return true; }
+
+    Integer forA, forB;
+
+    void cofactors(const Cofactors &m) {
+      auto nextA = forA * m.a + forB * m.b;
+      forB = forA * m.c + forB * m.d;
+      forA = std::move(nextA);
+    }
+
+    void quotient(slices_t quotient) {
+      auto next = forA - forB * Integer{std::move(quotient), true};
+      forA = std::move(forB);
+      forB = std::move(next);
+    }
+  };
+
+  auto leftIsSmaller = kernels::compare(left.slices, right.slices) == compat::strong_ordering::less;
+  Coefficients coefficients{Integer{leftIsSmaller ? 0 : 1}, Integer{leftIsSmaller ? 1 : 0}};
+  auto gcd = Integer{leftIsSmaller ? lehmer(right.slices, left.slices, &coefficients)
+                                   : lehmer(left.slices, right.slices, &coefficients),
+                     true};
+
+  // gcd == |left| * x + |right| * y
+  auto x = std::move(coefficients.forA);
+  auto y = (gcd - left.absolute() * x) / right.absolute();
+
+  if (!left.positive()) x *= -1;
+  if (!right.positive()) y *= -1;
+  return {std::move(gcd), std::move(x), std::move(y)};
+}
@@ -0,0 +1,292 @@
+/*
+ * Copyright (c) 2026 Emanuel Machado da Silva
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "integer_kernels.h"
+
+#include "common/assertions.h" // ensure
+
+#include <algorithm> // std::copy, std::copy_backward, std::fill
+#include <bit>       // std::countl_zero, std::countr_zero, std::popcount
+#include <limits>    // std::numeric_limits
+
+#ifdef __AVX2__
+#include <immintrin.h> // _mm256_*
+#endif
+
+using pzl::kernels::SLICE_BITS;
+using pzl::kernels::SlicesView;
+using pzl::kernels::value_t;
+using pzl::kernels::wide_t;
+
+namespace {
+
+#ifdef __AVX2__
+static_assert(SLICE_BITS == 32, "The AVX2 kernels work on 8 lanes of 32 bits");
+
+constexpr size_t LANES = 8;
+
+inline uint32_t laneMask(__m256i lanes) {
+  return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(lanes)));
+}
+
+// The opposite of laneMask, each lane is all ones if its bit is set, and all zeroes otherwise
+inline __m256i expandMask(uint32_t mask) {
+  const auto bits = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+  return _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32(static_cast<int>(mask)), bits), bits);
+}
+
+// Carry lookahead over 8 lanes, done with a single scalar addition: lanes that generate a carry hand it to the next
+// one, and lanes that are all ones (or all zeroes, for borrows) pass along whatever they got, just like bits would
+// Returns the lanes that receive a carry, and updates `carry` to the one coming out of the last lane
+inline uint32_t resolveCarries(uint32_t generated, uint32_t propagating, uint32_t *carry) {
+  auto incoming = ((generated << 1) | *carry) + propagating;
+  *carry = incoming >> LANES;
+  return (incoming ^ propagating) & 0xFF;
+}
+
+// Adds as many slices as fit in whole vectors, and returns how many that was
+size_t addLanes(value_t *target, const value_t *right, size_t size, uint32_t *carry) {
+  const auto sign = _mm256_set1_epi32(std::numeric_limits<int32_t>::min()); // To compare them as unsigned
+  const auto ones = _mm256_set1_epi32(-1);
+
+  size_t i = 0;
+  for (; i + LANES <= size; i += LANES) {
+    auto left = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(target + i));
+    auto sum = _mm256_add_epi32(left, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(right + i)));
+
+    // The sum wrapped around if it's smaller than where it started
+    auto generated = laneMask(_mm256_cmpgt_epi32(_mm256_xor_si256(left, sign), _mm256_xor_si256(sum, sign)));
+    auto propagating = laneMask(_mm256_cmpeq_epi32(sum, ones));
+    auto incoming = resolveCarries(generated, propagating, carry);
+
+    // Subtracting all ones is the same as adding one
+    sum = _mm256_sub_epi32(sum, expandMask(incoming));
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(target + i), sum);
+  }
+
+  return i;
+}
+
+// Same as addLanes, but subtracting
+size_t subtractLanes(value_t *target, const value_t *right, size_t size, uint32_t *borrow) {
+  const auto sign = _mm256_set1_epi32(std::numeric_limits<int32_t>::min());
+
+  size_t i = 0;
+  for (; i + LANES <= size; i += LANES) {
+    auto left = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(target + i));
+    auto subtrahend = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(right + i));
+    auto difference = _mm256_sub_epi32(left, subtrahend);
+
+    auto generated = laneMask(_mm256_cmpgt_epi32(_mm256_xor_si256(subtrahend, sign), _mm256_xor_si256(left, sign)));
+    auto propagating = laneMask(_mm256_cmpeq_epi32(difference, _mm256_setzero_si256()));
+    auto incoming = resolveCarries(generated, propagating, borrow);
+
+    difference = _mm256_add_epi32(difference, expandMask(incoming));
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(target + i), difference);
+  }
+
+  return i;
+}
+#endif // __AVX2__
+}
+
+compat::strong_ordering pzl::kernels::compare(SlicesView left, SlicesView right) {
+  auto lengthComparison = compat::compare(left.size, right.size);
+  if (lengthComparison != compat::strong_ordering::equal) {
+    return lengthComparison;
+  }
+
+  for (auto i = left.size; i > 0; --i) {
+    auto sliceComparison = compat::compare(left.data[i - 1], right.data[i - 1]);
+    if (sliceComparison != compat::strong_ordering::equal) {
+      return sliceComparison;
+    }
+  }
+
+  return compat::strong_ordering::equal;
+}
+
+compat::strong_ordering pzl::kernels::compareToScalar(SlicesView slices, uintmax_t value) {
+  // Since the slices are trimmed, anything longer than a scalar is bigger than any scalar
+  if (slices.size * SLICE_BITS > std::numeric_limits<uintmax_t>::digits) return compat::strong_ordering::greater;
+
+  uintmax_t magnitude = 0;
+  for (auto i = slices.size; i > 0; --i) {
+    magnitude = (magnitude << SLICE_BITS) | slices.data[i - 1];
+  }
+
+  return compat::compare(magnitude, value);
+}
+
+value_t pzl::kernels::addInto(value_t *target, size_t targetSize, SlicesView right) {
+  ensure(right.size <= targetSize);
+
+  wide_t carry = 0;
+  size_t i = 0;
+#ifdef __AVX2__
+  uint32_t vectorCarry = 0;
+  i = addLanes(target, right.data, right.size, &vectorCarry);
+  carry = vectorCarry;
+#endif
+  for (; i < right.size; ++i) {
+    wide_t sum = wide_t{target[i]} + right.data[i] + carry;
+    target[i] = static_cast<value_t>(sum);
+    carry = sum >> SLICE_BITS;
+  }
+
+  for (; carry && i < targetSize; ++i) {
+    carry = ++target[i] == 0;
+  }
+
+  return static_cast<value_t>(carry);
+}
+
+value_t pzl::kernels::subtractFrom(value_t *target, size_t targetSize, SlicesView right) {
+  ensure(right.size <= targetSize);
+
+  wide_t borrow = 0;
+  size_t i = 0;
+#ifdef __AVX2__
+  uint32_t vectorBorrow = 0;
+  i = subtractLanes(target, right.data, right.size, &vectorBorrow);
+  borrow = vectorBorrow;
+#endif
+  for (; i < right.size; ++i) {
+    wide_t difference = wide_t{target[i]} - right.data[i] - borrow;
+    target[i] = static_cast<value_t>(difference);
+    borrow = difference >> (SLICE_BITS * 2 - 1); // It wrapped around if the top bit is set
+  }
+
+  for (; borrow && i < targetSize; ++i) {
+    borrow = target[i]-- == 0;
+  }
+
+  return static_cast<value_t>(borrow);
+}
+
+value_t pzl::kernels::subtractReversed(value_t *target, size_t targetSize, SlicesView left) {
+  ensure(left.size == targetSize);
+
+  wide_t borrow = 0;
+  for (size_t i = 0; i < targetSize; ++i) {
+    wide_t difference = wide_t{left.data[i]} - target[i] - borrow;
+    target[i] = static_cast<value_t>(difference);
+    borrow = difference >> (SLICE_BITS * 2 - 1);
+  }
+
+  return static_cast<value_t>(borrow);
+}
+
+size_t pzl::kernels::bitLength(SlicesView slices) {
+  if (slices.empty()) return 0;
+  return slices.size * SLICE_BITS - static_cast<size_t>(std::countl_zero(slices.data[slices.size - 1]));
+}
+
+size_t pzl::kernels::countTrailingZeros(SlicesView slices) {
+  for (size_t i = 0; i < slices.size; ++i) {
+    if (slices.data[i] != 0) return i * SLICE_BITS + static_cast<size_t>(std::countr_zero(slices.data[i]));
+  }
+
+  ensure(false); // Zero doesn't have any set bits to count up to
+  return 0;
+}
+
+size_t pzl::kernels::popCount(SlicesView slices) {
+  size_t result = 0;
+  for (size_t i = 0; i < slices.size; ++i) {
+    result += static_cast<size_t>(std::popcount(slices.data[i]));
+  }
+  return result;
+}
+
+void pzl::kernels::shiftLeft(SlicesView slices, size_t bits, value_t *out) {
+  auto offset = bits / SLICE_BITS;
+  auto shift = bits % SLICE_BITS;
+
+  // Going from the top down, so we never overwrite a slice we haven't read yet when working in place
+  if (shift == 0) {
+    out[slices.size + offset] = 0;
+    std::copy_backward(slices.data, slices.data + slices.size, out + slices.size + offset);
+  } else {
+    value_t carry = 0;
+    for (auto i = slices.size; i-- > 0;) {
+      auto slice = slices.data[i];
+      out[i + offset + 1] = carry | (slice >> (SLICE_BITS - shift));
+      carry = slice << shift;
+    }
+    out[offset] = carry;
+  }
+
+  std::fill(out, out + offset, 0);
+}
+
+void pzl::kernels::shiftRight(SlicesView slices, size_t bits, value_t *out) {
+  auto offset = bits / SLICE_BITS;
+  auto shift = bits % SLICE_BITS;
+  if (offset >= slices.size) return;
+
+  auto size = slices.size - offset;
+  if (shift == 0) {
+    std::copy(slices.data + offset, slices.data + slices.size, out);
+    return;
+  }
+
+  for (size_t i = 0; i < size; ++i) {
+    auto next = i + 1 < size ? slices.data[i + offset + 1] << (SLICE_BITS - shift) : 0;
+    out[i] = (slices.data[i + offset] >> shift) | next;
+  }
+}
+
+value_t pzl::kernels::multiplyBySlice(value_t *slices, size_t size, value_t multiplier) {
+  wide_t carry = 0;
+  for (size_t i = 0; i < size; ++i) {
+    wide_t current = wide_t{slices[i]} * multiplier + carry;
+    slices[i] = static_cast<value_t>(current);
+    carry = current >> SLICE_BITS;
+  }
+  return static_cast<value_t>(carry);
+}
+
+value_t pzl::kernels::multiplyAddBySlice(const value_t *slices, size_t size, value_t multiplier, value_t addend,
+                                         value_t *out) {
+  // The biggest this gets is (SLICE_MAX * SLICE_MAX + SLICE_MAX), so it never overflows
+  wide_t carry = addend;
+  for (size_t i = 0; i < size; ++i) {
+    carry += wide_t{slices[i]} * multiplier;
+    out[i] = static_cast<value_t>(carry);
+    carry >>= SLICE_BITS;
+  }
+  return static_cast<value_t>(carry);
+}
+
+value_t pzl::kernels::divideBySlice(value_t *slices, size_t size, value_t divisor) {
+  ensure(divisor != 0);
+
+  wide_t remainder = 0;
+  for (auto i = size; i > 0; --i) {
+    wide_t current = (remainder << SLICE_BITS) | slices[i - 1];
+    slices[i - 1] = static_cast<value_t>(current / divisor);
+    remainder = current % divisor;
+  }
+
+  return static_cast<value_t>(remainder);
+}
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2026 Emanuel Machado da Silva
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "common/numbers/integer.h"
+#include "compat/compare.h" // compat::strong_ordering
+
+#include <algorithm>   // std::min
+#include <cstddef>     // size_t
+#include <cstdint>     // uint64_t
+#include <string_view> // std::string_view
+#include <vector>      // std::vector
+
+// Low-level routines that work directly on slices, shared by the pzl::Integer implementation files
+namespace pzl::kernels {
+
+using value_t = Integer::value_t;
+using slices_t = Integer::slices_t;
+using wide_t = uint64_t; // Big enough for a slice product plus two slices, so carries come for free in the top half
+
+constexpr value_t SLICE_BITS = 32;
+constexpr value_t SLICE_MAX = 0xFFFFFFFF;
+constexpr wide_t SLICE_SIZE = wide_t{SLICE_MAX} + 1;
+
+// A read-only window over low-endian slices, so we can work on parts of a number without copying them around
+struct SlicesView {
+  const value_t *data;
+  size_t size;
+
+  SlicesView(const value_t *data, size_t size) : data(data), size(size) {}
+  SlicesView(const std::vector<value_t> &slices) : data(slices.data()), size(slices.size()) {} // NOLINT
+  SlicesView(const slices_t &slices) : data(slices.data()), size(slices.size()) {}             // NOLINT
+
+  [[nodiscard]] inline bool empty() const { return size == 0; }
+
+  [[nodiscard]] inline SlicesView subview(size_t offset, size_t count) const {
+    if (offset >= size) return SlicesView{data, 0};
+    return SlicesView{data + offset, std::min(count, size - offset)};
+  }
+
+  [[nodiscard]] inline SlicesView trimmed() const {
+    auto newSize = size;
+    while (newSize > 0 && data[newSize - 1] == 0) {
+      --newSize;
+    }
+    return SlicesView{data, newSize};
+  }
+};
+
+// Works on both std::vector and slices_t
+template <typename Slices>
+inline void trim(Slices *slices) {
+  while (!slices->empty() && slices->back() == 0) {
+    slices->pop_back();
+  }
+}
+
+// Both sides must be trimmed
+compat::strong_ordering compare(SlicesView left, SlicesView right);
+
+// Same as compare, but against a scalar, so it doesn't need to be split into slices first
+compat::strong_ordering compareToScalar(SlicesView slices, uintmax_t value);
+
+// Adds `right` into `target`, which must be at least as long as it, and returns the carry out of the last slice
+value_t addInto(value_t *target, size_t targetSize, SlicesView right);
+
+// Subtracts `right` from `target`, which must be at least as long as it, and returns the borrow out of the last slice
+value_t subtractFrom(value_t *target, size_t targetSize, SlicesView right);
+
+// Replaces `target` with `left - target`, both must be the same length, and returns the borrow out of the last slice
+value_t subtractReversed(value_t *target, size_t targetSize, SlicesView left);
+
+// Bit-level queries, the slices must be trimmed; countTrailingZeros doesn't make sense for zero
+size_t bitLength(SlicesView slices);
+size_t countTrailingZeros(SlicesView slices);
+size_t popCount(SlicesView slices);
+
+// `out` needs room for slices.size + bits / SLICE_BITS + 1 slices, and may be the same as slices.data
+void shiftLeft(SlicesView slices, size_t bits, value_t *out);
+
+// `out` needs room for slices.size - bits / SLICE_BITS slices (if there are any left), and may be slices.data
+void shiftRight(SlicesView slices, size_t bits, value_t *out);
+
+// Multiplies in place, and returns the slice that overflowed
+value_t multiplyBySlice(value_t *slices, size_t size, value_t multiplier);
+
+// out = slices * multiplier + addend, in a single pass; returns the carry out of the top slice, `out` may be slices
+value_t multiplyAddBySlice(const value_t *slices, size_t size, value_t multiplier, value_t addend, value_t *out);
+
+// Divides in place and returns the remainder
+value_t divideBySlice(value_t *slices, size_t size, value_t divisor);
+
+// Long division, the divisor must be trimmed and not longer than the dividend
+// Either output may be null, otherwise `quotient` needs room for (dividend.size - divisor.size + 1) slices and
+// `remainder` for divisor.size slices; `remainder` is allowed to point into the dividend
+void divide(SlicesView dividend, SlicesView divisor, value_t *quotient, value_t *remainder);
+
+// A divisor that's been normalized and had its reciprocal worked out, so big numbers can be divided by it with a few
+// multiplications, instead of Algorithm D's quadratic loop; worth keeping around when dividing by it more than once
+struct ReciprocalDivisor {
+  explicit ReciprocalDivisor(SlicesView divisor);
+
+  [[nodiscard]] inline size_t size() const { return normalized.size(); }
+
+  std::vector<value_t> normalized;
+  std::vector<value_t> reciprocal;
+  value_t scale;
+};
+
+// From this size on (in slices), for both the divisor and the quotient, dividing through the reciprocal is faster
+constexpr size_t RECIPROCAL_DIVISION_THRESHOLD = 500;
+
+// Same as above, for a dividend that's not shorter than the divisor
+void divide(SlicesView dividend, const ReciprocalDivisor &divisor, value_t *quotient, value_t *remainder);
+
+struct MultiplicationThresholds {
+  size_t karatsuba;
+  size_t toomCook3;
+  size_t numberTheoretic;
+};
+
+// The operand size (in slices) from which each algorithm takes over, see benchmarks/multiplication_thresholds.cpp
+extern MultiplicationThresholds multiplicationThresholds;
+
+// `out` must have room for exactly left.size + right.size slices, and must not overlap the inputs
+void multiply(SlicesView left, SlicesView right, value_t *out);
+
+// These skip the size checks, they're only exposed so we can benchmark them against each other
+void multiplySchoolbook(SlicesView left, SlicesView right, value_t *out);
+void multiplyKaratsuba(SlicesView left, SlicesView right, value_t *out);
+void multiplyToomCook3(SlicesView left, SlicesView right, value_t *out);
+void multiplyNumberTheoretic(SlicesView left, SlicesView right, value_t *out);
+
+// The NTT can't handle products whose coefficients or lengths would overflow its primes
+bool canMultiplyNumberTheoretic(size_t leftSize, size_t rightSize);
+
+// Conversions from and to base 10, `digits` must only have the characters 0 to 9
+slices_t parseDecimal(std::string_view digits);
+
+// How many characters formatDecimal might need, it can overshoot a little, but never undershoots
+size_t decimalDigitsBound(SlicesView slices);
+
+// Writes the digits back to front, ending right before `last`, and returns where they start
+char *formatDecimal(SlicesView slices, char *last);
+}
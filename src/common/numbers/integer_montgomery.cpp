@@ -0,0 +1,264 @@
+/*
+ * Copyright (c) 2026 Emanuel Machado da Silva
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "montgomery.h"
+#include "integer_kernels.h"
+
+#include "common/assertions.h" // ensure, UNUSED
+
+#include <algorithm>   // std::copy
+#include <array>       // std::array
+#include <cstdlib>     // std::abort
+#include <type_traits> // std::is_same_v
+#include <utility>     // std::move
+
+using pzl::BasicMontgomeryContext;
+using pzl::Integer;
+using pzl::kernels::SLICE_BITS;
+using pzl::kernels::SlicesView;
+using pzl::kernels::value_t;
+using pzl::kernels::wide_t;
+
+namespace {
+
+template <typename Storage>
+constexpr bool isDynamic = std::is_same_v<Storage, Integer::slices_t>;
+
+// Zeroed out, with room for `size` slices
+template <typename Storage>
+Storage zeroed(size_t size) {
+  if constexpr (isDynamic<Storage>) {
+    return Storage(size);
+  } else {
+    ensure(size <= std::tuple_size_v<Storage>);
+    return Storage{};
+  }
+}
+
+// Room for the two extra slices the multiplication needs
+template <typename Storage>
+struct ScratchFor {
+  using type = Integer::slices_t;
+  static type make(size_t size) { return type(size + 2); }
+};
+
+template <size_t N>
+struct ScratchFor<std::array<value_t, N>> {
+  using type = std::array<value_t, N + 2>;
+  static type make(size_t) { return type{}; }
+};
+
+inline bool isAtLeast(const value_t *value, const value_t *modulus, size_t size) {
+  for (auto i = size; i-- > 0;) {
+    if (value[i] != modulus[i]) return value[i] > modulus[i];
+  }
+  return true;
+}
+
+// Montgomery's REDC, interleaved with the multiplication (the CIOS method, from Koç, Acar and Kaliski's "Analyzing and
+// Comparing Montgomery Multiplication Algorithms"): writes left * right / R mod modulus to the bottom `size` slices
+// of `scratch`, which needs room for size + 2 of them
+inline void multiplyAndReduce(const value_t *left, const value_t *right, const value_t *modulus, size_t size,
+                              value_t inverse, value_t *scratch) {
+  std::fill(scratch, scratch + size + 2, 0);
+
+  for (size_t i = 0; i < size; ++i) {
+    // scratch += left * right[i]
+    wide_t carry = 0;
+    for (size_t j = 0; j < size; ++j) {
+      wide_t current = scratch[j] + wide_t{left[j]} * right[i] + carry;
+      scratch[j] = static_cast<value_t>(current);
+      carry = current >> SLICE_BITS;
+    }
+    wide_t top = scratch[size] + carry;
+    scratch[size] = static_cast<value_t>(top);
+    scratch[size + 1] = static_cast<value_t>(top >> SLICE_BITS);
+
+    // Adding the multiple of the modulus that clears the bottom slice, then dropping that slice
+    auto factor = scratch[0] * inverse;
+    carry = (scratch[0] + wide_t{factor} * modulus[0]) >> SLICE_BITS;
+    for (size_t j = 1; j < size; ++j) {
+      wide_t current = scratch[j] + wide_t{factor} * modulus[j] + carry;
+      scratch[j - 1] = static_cast<value_t>(current);
+      carry = current >> SLICE_BITS;
+    }
+    top = scratch[size] + carry;
+    scratch[size - 1] = static_cast<value_t>(top);
+    scratch[size] = scratch[size + 1] + static_cast<value_t>(top >> SLICE_BITS);
+  }
+
+  // It's below twice the modulus by now
+  if (scratch[size] != 0 || isAtLeast(scratch, modulus, size)) {
+    pzl::kernels::subtractFrom(scratch, size + 1, SlicesView{modulus, size});
+  }
+}
+}
+
+template <typename Storage>
+BasicMontgomeryContext<Storage>::BasicMontgomeryContext(const Integer &modulus) : _modulus(modulus) {
+  // Not just an ensure, which compiles out in Release, where this would go on to write past the end of the std::array
+  if (!fits(modulus)) std::abort();
+  ensure(modulus > 1 && (modulus.slices[0] & 1) == 1); // Montgomery form needs the modulus to be coprime to R
+
+  auto size = modulus.slices.size();
+  modulusSlices = fromInteger(modulus);
+
+  // Newton's iteration for the inverse modulo 2^32, every odd number is its own inverse modulo 8, and each step
+  // doubles the number of correct bits from there
+  value_t modulusInverse = modulus.slices[0];
+  for (auto i = 0; i < 4; ++i) {
+    modulusInverse *= 2 - modulus.slices[0] * modulusInverse;
+  }
+  inverse = 0 - modulusInverse;
+
+  // R itself takes one slice more than the modulus, but R - modulus doesn't, and it's the same modulo the modulus
+  Integer::slices_t complement(size);
+  wide_t carry = 1;
+  for (size_t i = 0; i < size; ++i) {
+    carry += static_cast<value_t>(~modulus.slices[i]);
+    complement[i] = static_cast<value_t>(carry);
+    carry >>= SLICE_BITS;
+  }
+  pzl::kernels::trim(&complement);
+  _one = fromInteger(Integer{std::move(complement), true} % modulus);
+
+  if constexpr (isDynamic<Storage>) {
+    rSquared = fromInteger((Integer{1} << (2 * SLICE_BITS * size)) % modulus);
+  } else {
+    // Doubling R once for every bit in it, so the std::array contexts don't need an Integer twice the modulus' size,
+    // which wouldn't fit in its inline slices
+    rSquared = _one;
+    for (size_t i = 0; i < SLICE_BITS * size; ++i) {
+      rSquared = add(rSquared, rSquared);
+    }
+  }
+}
+
+template <typename Storage>
+bool BasicMontgomeryContext<Storage>::fits(const Integer &modulus) {
+  if constexpr (isDynamic<Storage>) {
+    UNUSED(modulus);
+    return true;
+  } else {
+    return modulus.slices.size() <= std::tuple_size_v<Storage>;
+  }
+}
+
+template <typename Storage>
+Storage BasicMontgomeryContext<Storage>::fromInteger(const Integer &reduced) const {
+  auto result = zeroed<Storage>(_modulus.slices.size());
+  std::copy(reduced.slices.begin(), reduced.slices.end(), result.begin());
+  return result;
+}
+
+template <typename Storage>
+Storage BasicMontgomeryContext<Storage>::toMontgomery(const Integer &value) const {
+  if (value.positive() && value < _modulus) return multiply(fromInteger(value), rSquared);
+
+  auto reduced = value % _modulus;
+  if (!reduced.positive()) reduced += _modulus;
+  return multiply(fromInteger(reduced), rSquared);
+}
+
+template <typename Storage>
+Integer BasicMontgomeryContext<Storage>::fromMontgomery(const Storage &residue) const {
+  // Multiplying by a plain 1 divides it by R
+  auto plainOne = zeroed<Storage>(_modulus.slices.size());
+  plainOne[0] = 1;
+
+  auto result = multiply(residue, plainOne);
+  Integer::slices_t slices(result.data(), result.data() + _modulus.slices.size());
+  pzl::kernels::trim(&slices);
+  return Integer{std::move(slices), true};
+}
+
+template <typename Storage>
+Storage BasicMontgomeryContext<Storage>::add(const Storage &left, const Storage &right) const {
+  auto size = _modulus.slices.size();
+  auto result = left;
+  auto carry = pzl::kernels::addInto(result.data(), size, SlicesView{right.data(), size});
+  if (carry || isAtLeast(result.data(), modulusSlices.data(), size)) {
+    pzl::kernels::subtractFrom(result.data(), size, SlicesView{modulusSlices.data(), size});
+  }
+  return result;
+}
+
+template <typename Storage>
+Storage BasicMontgomeryContext<Storage>::subtract(const Storage &left, const Storage &right) const {
+  auto size = _modulus.slices.size();
+  auto result = left;
+  auto borrow = pzl::kernels::subtractFrom(result.data(), size, SlicesView{right.data(), size});
+  if (borrow) {
+    pzl::kernels::addInto(result.data(), size, SlicesView{modulusSlices.data(), size});
+  }
+  return result;
+}
+
+template <typename Storage>
+Storage BasicMontgomeryContext<Storage>::multiply(const Storage &left, const Storage &right) const {
+  auto result = left;
+  auto scratch = ScratchFor<Storage>::make(_modulus.slices.size());
+  multiplyInPlace(&result, right, scratch.data());
+  return result;
+}
+
+template <typename Storage>
+void BasicMontgomeryContext<Storage>::multiplyInPlace(Storage *target, const Storage &by, value_t *scratch) const {
+  auto size = _modulus.slices.size();
+  multiplyAndReduce(target->data(), by.data(), modulusSlices.data(), size, inverse, scratch);
+  std::copy(scratch, scratch + size, target->data());
+}
+
+template <typename Storage>
+Storage BasicMontgomeryContext<Storage>::power(const Storage &base, const Integer &exponent) const {
+  ensure(exponent.positive()); // Haven't implemented this yet
+
+  // Fixed 4-bit windows, which never straddle two slices
+  constexpr size_t WINDOW_BITS = 4;
+  std::array<Storage, 1 << WINDOW_BITS> powers;
+  powers[0] = _one;
+  for (size_t i = 1; i < powers.size(); ++i) {
+    powers[i] = multiply(powers[i - 1], base);
+  }
+
+  // Everything from here on happens in place, with no allocations
+  auto scratch = ScratchFor<Storage>::make(_modulus.slices.size());
+  auto windows = (pzl::kernels::bitLength(exponent.slices) + WINDOW_BITS - 1) / WINDOW_BITS;
+  auto result = _one;
+  for (auto i = windows; i-- > 0;) {
+    if (i + 1 < windows) {
+      for (size_t j = 0; j < WINDOW_BITS; ++j) {
+        multiplyInPlace(&result, result, scratch.data());
+      }
+    }
+
+    auto bit = i * WINDOW_BITS;
+    auto window = (exponent.slices[bit / SLICE_BITS] >> (bit % SLICE_BITS)) & ((1u << WINDOW_BITS) - 1);
+    if (window != 0) multiplyInPlace(&result, powers[window], scratch.data());
+  }
+
+  return result;
+}
+
+template struct pzl::BasicMontgomeryContext<Integer::slices_t>;
+template struct pzl::BasicMontgomeryContext<std::array<value_t, 2>>;
+template struct pzl::BasicMontgomeryContext<std::array<value_t, 4>>;
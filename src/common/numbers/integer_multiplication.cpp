@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) 2026 Emanuel Machado da Silva
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "integer_kernels.h"
+
+#include "common/assertions.h" // ensure
+
+#include <algorithm> // std::fill, std::copy, std::max
+#include <array>     // std::array
+#include <cstddef>   // std::ptrdiff_t
+#include <tuple>     // std::tie
+#include <utility>   // std::swap, std::move
+
+using pzl::kernels::SlicesView;
+using pzl::kernels::value_t;
+using pzl::kernels::wide_t;
+
+#ifndef PZL_KARATSUBA_THRESHOLD
+#define PZL_KARATSUBA_THRESHOLD 40
+#endif
+
+#ifndef PZL_TOOM_COOK_3_THRESHOLD
+#define PZL_TOOM_COOK_3_THRESHOLD 256
+#endif
+
+#ifndef PZL_NTT_THRESHOLD
+#define PZL_NTT_THRESHOLD 16384
+#endif
+
+pzl::kernels::MultiplicationThresholds pzl::kernels::multiplicationThresholds{
+    PZL_KARATSUBA_THRESHOLD, PZL_TOOM_COOK_3_THRESHOLD, PZL_NTT_THRESHOLD};
+
+namespace {
+
+// Toom-Cook needs to subtract intermediate values that might be negative, so it works on these instead
+struct SignedSlices {
+  std::vector<value_t> magnitude; // Always trimmed
+  bool negative = false;
+
+  SignedSlices() = default;
+  explicit SignedSlices(SlicesView view) : magnitude(view.data, view.data + view.trimmed().size) {}
+  SignedSlices(std::vector<value_t> magnitude, bool negative)
+      : magnitude(std::move(magnitude)), negative(negative && !this->magnitude.empty()) {}
+};
+
+std::vector<value_t> addMagnitudes(SlicesView left, SlicesView right) {
+  if (left.size < right.size) std::swap(left, right);
+
+  std::vector<value_t> result(left.size + 1, 0);
+  std::copy(left.data, left.data + left.size, result.begin());
+  pzl::kernels::addInto(result.data(), result.size(), right);
+  pzl::kernels::trim(&result);
+  return result;
+}
+
+SignedSlices add(const SignedSlices &left, const SignedSlices &right) {
+  if (left.negative == right.negative) {
+    return SignedSlices{addMagnitudes(left.magnitude, right.magnitude), left.negative};
+  }
+
+  auto leftIsSmaller = pzl::kernels::compare(left.magnitude, right.magnitude) == compat::strong_ordering::less;
+  const auto &[bigger, smaller] = leftIsSmaller ? std::tie(right, left) : std::tie(left, right);
+
+  auto result = bigger.magnitude;
+  auto borrow = pzl::kernels::subtractFrom(result.data(), result.size(), smaller.magnitude);
+  ensure(borrow == 0);
+  pzl::kernels::trim(&result);
+  return SignedSlices{std::move(result), bigger.negative};
+}
+
+inline SignedSlices subtract(const SignedSlices &left, const SignedSlices &right) {
+  return add(left, SignedSlices{right.magnitude, !right.negative});
+}
+
+SignedSlices multiply(const SignedSlices &left, const SignedSlices &right) {
+  if (left.magnitude.empty() || right.magnitude.empty()) return SignedSlices{};
+
+  std::vector<value_t> result(left.magnitude.size() + right.magnitude.size());
+  pzl::kernels::multiply(left.magnitude, right.magnitude, result.data());
+  pzl::kernels::trim(&result);
+  return SignedSlices{std::move(result), left.negative != right.negative};
+}
+
+SignedSlices divideExactly(SignedSlices value, value_t divisor) {
+  auto remainder = pzl::kernels::divideBySlice(value.magnitude.data(), value.magnitude.size(), divisor);
+  ensure(remainder == 0);
+  pzl::kernels::trim(&value.magnitude);
+  return value;
+}
+
+// Multiplies a number larger than twice the other by splitting it in chunks, so the actual multiplications are balanced
+void multiplyUnbalanced(SlicesView left, SlicesView right, value_t *out) {
+  auto outSize = left.size + right.size;
+  std::fill(out, out + outSize, 0);
+
+  std::vector<value_t> partial(right.size * 2);
+  for (size_t offset = 0; offset < left.size; offset += right.size) {
+    auto chunk = left.subview(offset, right.size);
+    pzl::kernels::multiply(chunk, right, partial.data());
+
+    auto product = SlicesView{partial.data(), chunk.size + right.size};
+    auto carry = pzl::kernels::addInto(out + offset, outSize - offset, product);
+    ensure(carry == 0);
+  }
+}
+}
+
+void pzl::kernels::multiply(SlicesView left, SlicesView right, value_t *out) {
+  if (left.size < right.size) std::swap(left, right);
+
+  if (right.empty()) {
+    std::fill(out, out + left.size, 0);
+  } else if (right.size < multiplicationThresholds.karatsuba) {
+    multiplySchoolbook(left, right, out);
+  } else if (right.size <= (left.size + 1) / 2) {
+    multiplyUnbalanced(left, right, out);
+  } else if (right.size < multiplicationThresholds.toomCook3) {
+    multiplyKaratsuba(left, right, out);
+  } else if (right.size < multiplicationThresholds.numberTheoretic ||
+             !canMultiplyNumberTheoretic(left.size, right.size)) {
+    multiplyToomCook3(left, right, out);
+  } else {
+    multiplyNumberTheoretic(left, right, out);
+  }
+}
+
+void pzl::kernels::multiplySchoolbook(SlicesView left, SlicesView right, value_t *out) {
+  std::fill(out, out + left.size + right.size, 0);
+
+  for (size_t i = 0; i < right.size; ++i) {
+    wide_t multiplier = right.data[i];
+    if (multiplier == 0) continue;
+
+    // (2^32 - 1)^2 + 2 * (2^32 - 1) is exactly 2^64 - 1, so neither the product nor the carry can overflow
+    wide_t carry = 0;
+    for (size_t j = 0; j < left.size; ++j) {
+      wide_t current = multiplier * left.data[j] + out[i + j] + carry;
+      out[i + j] = static_cast<value_t>(current);
+      carry = current >> SLICE_BITS;
+    }
+    out[i + left.size] = static_cast<value_t>(carry);
+  }
+}
+
+void pzl::kernels::multiplyKaratsuba(SlicesView left, SlicesView right, value_t *out) {
+  // left = l1 * B^m + l0, right = r1 * B^m + r0
+  // left * right = (l1 * r1) * B^2m + ((l0 + l1) * (r0 + r1) - l1 * r1 - l0 * r0) * B^m + l0 * r0
+  if (left.size < right.size) std::swap(left, right);
+
+  auto outSize = left.size + right.size;
+  auto half = (left.size + 1) / 2;
+  ensure(right.size > half);
+
+  auto l0 = left.subview(0, half), l1 = left.subview(half, half);
+  auto r0 = right.subview(0, half), r1 = right.subview(half, half);
+
+  // l0 * r0 and l1 * r1 don't overlap, so they can go straight into the output
+  multiply(l0, r0, out);
+  multiply(l1, r1, out + half * 2);
+
+  std::vector<value_t> leftSum(half + 1, 0), rightSum(half + 1, 0);
+  std::copy(l0.data, l0.data + l0.size, leftSum.begin());
+  addInto(leftSum.data(), leftSum.size(), l1);
+  std::copy(r0.data, r0.data + r0.size, rightSum.begin());
+  addInto(rightSum.data(), rightSum.size(), r1);
+
+  std::vector<value_t> middle(leftSum.size() + rightSum.size());
+  multiply(SlicesView{leftSum}.trimmed(), SlicesView{rightSum}.trimmed(), middle.data());
+
+  auto borrow = subtractFrom(middle.data(), middle.size(), SlicesView{out, half * 2});
+  borrow += subtractFrom(middle.data(), middle.size(), SlicesView{out + half * 2, outSize - half * 2});
+  ensure(borrow == 0);
+
+  auto carry = addInto(out + half, outSize - half, SlicesView{middle}.trimmed());
+  ensure(carry == 0);
+}
+
+void pzl::kernels::multiplyToomCook3(SlicesView left, SlicesView right, value_t *out) {
+  // Splits both sides in three parts, so each of them becomes a polynomial evaluated at B^k; we then multiply those
+  // polynomials by evaluating them at 0, 1, -1, -2 and infinity, and interpolating the results (Bodrato's sequence)
+  if (left.size < right.size) std::swap(left, right);
+
+  auto outSize = left.size + right.size;
+  auto third = (left.size + 2) / 3;
+
+  auto evaluate = [third](SlicesView view) {
+    SignedSlices m0{view.subview(0, third)}, m1{view.subview(third, third)}, m2{view.subview(third * 2, third)};
+
+    auto p = add(m0, m2);
+    auto atOne = add(p, m1);
+    auto atMinusOne = subtract(p, m1);
+    auto sum = add(atMinusOne, m2);
+    auto atMinusTwo = subtract(add(sum, sum), m0);
+
+    return std::array<SignedSlices, 5>{m0, atOne, atMinusOne, atMinusTwo, m2};
+  };
+
+  auto leftPoints = evaluate(left);
+  auto rightPoints = evaluate(right);
+
+  std::array<SignedSlices, 5> products;
+  for (size_t i = 0; i < products.size(); ++i) {
+    products[i] = ::multiply(leftPoints[i], rightPoints[i]);
+  }
+  const auto &[atZero, atOne, atMinusOne, atMinusTwo, atInfinity] = products;
+
+  auto r0 = atZero;
+  auto r4 = atInfinity;
+  auto r3 = divideExactly(subtract(atMinusTwo, atOne), 3);
+  auto r1 = divideExactly(subtract(atOne, atMinusOne), 2);
+  auto r2 = subtract(atMinusOne, atZero);
+  r3 = add(divideExactly(subtract(r2, r3), 2), add(r4, r4));
+  r2 = subtract(add(r2, r1), r4);
+  r1 = subtract(r1, r3);
+
+  // The coefficients might be negative, so we add all the positive ones before subtracting the rest, and only then
+  // copy the result into the output, since the partial sums might not fit there
+  std::array<const SignedSlices *, 5> coefficients{&r0, &r1, &r2, &r3, &r4};
+  size_t scratchSize = outSize;
+  for (size_t i = 0; i < coefficients.size(); ++i) {
+    scratchSize = std::max(scratchSize, third * i + coefficients[i]->magnitude.size() + 1);
+  }
+
+  std::vector<value_t> scratch(scratchSize, 0);
+  for (size_t i = 0; i < coefficients.size(); ++i) {
+    if (!coefficients[i]->negative) {
+      addInto(scratch.data() + third * i, scratchSize - third * i, coefficients[i]->magnitude);
+    }
+  }
+  for (size_t i = 0; i < coefficients.size(); ++i) {
+    if (coefficients[i]->negative) {
+      auto borrow = subtractFrom(scratch.data() + third * i, scratchSize - third * i, coefficients[i]->magnitude);
+      ensure(borrow == 0);
+    }
+  }
+
+  ensure(SlicesView{scratch}.trimmed().size <= outSize);
+  std::copy(scratch.cbegin(), scratch.cbegin() + static_cast<std::ptrdiff_t>(outSize), out);
+}
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2026 Emanuel Machado da Silva
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "integer_kernels.h"
+
+#include "common/assertions.h" // ensure
+
+#include <algorithm> // std::min
+#include <cstdint>   // uint32_t, uint64_t
+#include <utility>   // std::swap
+#include <vector>    // std::vector
+
+// Multiplication through number-theoretic transforms: the slices are treated as polynomial coefficients and convolved
+// modulo three NTT-friendly primes, then the exact coefficients are rebuilt from the three residues (CRT)
+
+using pzl::kernels::SlicesView;
+using pzl::kernels::value_t;
+using pzl::kernels::wide_t;
+
+namespace {
+
+constexpr uint32_t power(uint64_t base, uint64_t exponent, uint32_t modulus) {
+  uint64_t result = 1;
+  base %= modulus;
+  while (exponent > 0) {
+    if (exponent & 1) result = result * base % modulus;
+    base = base * base % modulus;
+    exponent >>= 1;
+  }
+  return static_cast<uint32_t>(result);
+}
+
+constexpr uint32_t inverse(uint64_t value, uint32_t modulus) {
+  return power(value, modulus - 2, modulus);
+}
+
+template <uint32_t modulus, uint32_t primitiveRoot>
+struct Transform {
+  // The largest power of two that divides (modulus - 1), which limits how long the transforms can be
+  static constexpr size_t maxSize() {
+    size_t size = 1;
+    while ((modulus - 1) % (size * 2) == 0) {
+      size *= 2;
+    }
+    return size;
+  }
+
+  static void transform(std::vector<uint32_t> *values, bool inverted) {
+    auto &a = *values;
+    auto size = a.size();
+
+    for (size_t i = 1, j = 0; i < size; ++i) {
+      auto bit = size >> 1;
+      for (; j & bit; bit >>= 1) {
+        j ^= bit;
+      }
+      j ^= bit;
+      if (i < j) std::swap(a[i], a[j]);
+    }
+
+    std::vector<uint32_t> roots(size / 2);
+    for (size_t length = 2; length <= size; length <<= 1) {
+      auto step = power(primitiveRoot, (modulus - 1) / length, modulus);
+      if (inverted) step = inverse(step, modulus);
+
+      auto half = length / 2;
+      roots[0] = 1;
+      for (size_t k = 1; k < half; ++k) {
+        roots[k] = static_cast<uint32_t>(uint64_t{roots[k - 1]} * step % modulus);
+      }
+
+      for (size_t start = 0; start < size; start += length) {
+        for (size_t k = 0; k < half; ++k) {
+          auto u = a[start + k];
+          auto v = static_cast<uint32_t>(uint64_t{a[start + k + half]} * roots[k] % modulus);
+          a[start + k] = u + v >= modulus ? u + v - modulus : u + v;
+          a[start + k + half] = u >= v ? u - v : u + modulus - v;
+        }
+      }
+    }
+
+    if (inverted) {
+      auto sizeInverse = inverse(size, modulus);
+      for (auto &value : a) {
+        value = static_cast<uint32_t>(uint64_t{value} * sizeInverse % modulus);
+      }
+    }
+  }
+
+  static std::vector<uint32_t> load(SlicesView view, size_t size) {
+    std::vector<uint32_t> result(size, 0);
+    for (size_t i = 0; i < view.size; ++i) {
+      result[i] = view.data[i] % modulus;
+    }
+    return result;
+  }
+
+  // Returns the cyclic convolution of both sides modulo `modulus`, `size` has to be a power of two
+  static std::vector<uint32_t> convolve(SlicesView left, SlicesView right, size_t size) {
+    auto a = load(left, size);
+    transform(&a, false);
+
+    if (left.data == right.data && left.size == right.size) {
+      // Squaring, we can skip one of the transforms
+      for (auto &value : a) {
+        value = static_cast<uint32_t>(uint64_t{value} * value % modulus);
+      }
+    } else {
+      auto b = load(right, size);
+      transform(&b, false);
+      for (size_t i = 0; i < size; ++i) {
+        a[i] = static_cast<uint32_t>(uint64_t{a[i]} * b[i] % modulus);
+      }
+    }
+
+    transform(&a, true);
+    return a;
+  }
+};
+
+constexpr uint32_t P1 = 998244353; // 119 * 2^23 + 1
+constexpr uint32_t P2 = 167772161; // 5 * 2^25 + 1
+constexpr uint32_t P3 = 469762049; // 7 * 2^26 + 1
+
+using Transform1 = Transform<P1, 3>;
+using Transform2 = Transform<P2, 3>;
+using Transform3 = Transform<P3, 3>;
+
+constexpr size_t maxTransformSize = std::min({Transform1::maxSize(), Transform2::maxSize(), Transform3::maxSize()});
+
+// Every coefficient is a sum of up to `length` products of two slices, and it has to be smaller than P1 * P2 * P3
+// (about 7.8 * 10^25) for us to rebuild it
+constexpr wide_t maxProduct = wide_t{pzl::kernels::SLICE_MAX} * pzl::kernels::SLICE_MAX;
+constexpr size_t maxConvolutionLength = wide_t{P1} * P2 / ((maxProduct + P3 - 1) / P3);
+
+inline size_t transformSize(size_t leftSize, size_t rightSize) {
+  size_t size = 1;
+  while (size < leftSize + rightSize - 1) {
+    size <<= 1;
+  }
+  return size;
+}
+}
+
+bool pzl::kernels::canMultiplyNumberTheoretic(size_t leftSize, size_t rightSize) {
+  return std::min(leftSize, rightSize) <= maxConvolutionLength &&
+         transformSize(leftSize, rightSize) <= maxTransformSize;
+}
+
+void pzl::kernels::multiplyNumberTheoretic(SlicesView left, SlicesView right, value_t *out) {
+  ensure(canMultiplyNumberTheoretic(left.size, right.size));
+
+  auto outSize = left.size + right.size;
+  auto size = transformSize(left.size, right.size);
+
+  auto r1 = Transform1::convolve(left, right, size);
+  auto r2 = Transform2::convolve(left, right, size);
+  auto r3 = Transform3::convolve(left, right, size);
+
+  // Garner's algorithm: coefficient = v1 + v2 * P1 + v3 * P1 * P2
+  constexpr uint64_t p1InverseModP2 = inverse(P1, P2);
+  constexpr uint64_t p1p2InverseModP3 = inverse(uint64_t{P1} * P2 % P3, P3);
+
+  // The coefficient doesn't fit in 64 bits, so we split it as v1 + P1 * t, with t = high * SLICE_SIZE + low, and
+  // carry the `P1 * high` part over to the next slice
+  wide_t pending = 0;
+  for (size_t i = 0; i < outSize; ++i) {
+    if (i >= size) { // The product's topmost slice might be past the end of the convolution
+      out[i] = static_cast<value_t>(pending % SLICE_SIZE);
+      pending /= SLICE_SIZE;
+      continue;
+    }
+
+    wide_t v1 = r1[i];
+    wide_t v2 = (r2[i] + P2 - v1 % P2) % P2 * p1InverseModP2 % P2;
+    wide_t v3 = (r3[i] + P3 - (v1 + v2 * P1) % P3) % P3 * p1p2InverseModP3 % P3;
+
+    wide_t t = v2 + v3 * P2;
+    wide_t low = t % SLICE_SIZE, high = t / SLICE_SIZE;
+
+    wide_t current = v1 + P1 * low + pending;
+    out[i] = static_cast<value_t>(current % SLICE_SIZE);
+    pending = current / SLICE_SIZE + P1 * high;
+  }
+
+  ensure(pending == 0);
+}
@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2026 Emanuel Machado da Silva
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "integers.h"
+#include "integer_kernels.h"
+#include "montgomery.h"
+
+#include <array>   // std::array
+#include <cstddef> // size_t
+#include <cstdint> // uint64_t
+#include <utility> // std::swap
+
+using pzl::Integer;
+using pzl::kernels::SLICE_BITS;
+using pzl::kernels::SLICE_MAX;
+using pzl::kernels::SlicesView;
+
+namespace {
+
+constexpr size_t TRIAL_DIVISION_LIMIT = 1000;
+
+constexpr std::array<bool, TRIAL_DIVISION_LIMIT> sieve() {
+  std::array<bool, TRIAL_DIVISION_LIMIT> isPrime{};
+  for (size_t i = 2; i < TRIAL_DIVISION_LIMIT; ++i) {
+    isPrime[i] = true;
+  }
+  for (size_t i = 2; i * i < TRIAL_DIVISION_LIMIT; ++i) {
+    if (!isPrime[i]) continue;
+    for (auto multiple = i * i; multiple < TRIAL_DIVISION_LIMIT; multiple += i) {
+      isPrime[multiple] = false;
+    }
+  }
+  return isPrime;
+}
+
+constexpr auto IS_SMALL_PRIME = sieve();
+
+constexpr size_t countOddSmallPrimes() {
+  size_t count = 0;
+  for (size_t i = 3; i < TRIAL_DIVISION_LIMIT; i += 2) {
+    if (IS_SMALL_PRIME[i]) ++count;
+  }
+  return count;
+}
+
+constexpr auto ODD_SMALL_PRIMES = [] {
+  std::array<uint64_t, countOddSmallPrimes()> primes{};
+  size_t count = 0;
+  for (size_t i = 3; i < TRIAL_DIVISION_LIMIT; i += 2) {
+    if (IS_SMALL_PRIME[i]) primes[count++] = i;
+  }
+  return primes;
+}();
+
+uint64_t remainder(SlicesView value, uint64_t divisor) {
+  uint64_t result = 0;
+  for (auto i = value.size; i-- > 0;) {
+    result = ((result << SLICE_BITS) | value.data[i]) % divisor;
+  }
+  return result;
+}
+
+// Takes the primes in batches whose product still fits in a slice, so it's one pass over the value for each batch,
+// rather than one for each prime
+bool hasOddSmallFactor(SlicesView value) {
+  size_t first = 0;
+  while (first < ODD_SMALL_PRIMES.size()) {
+    uint64_t product = 1;
+    auto last = first;
+    while (last < ODD_SMALL_PRIMES.size() && product * ODD_SMALL_PRIMES[last] <= SLICE_MAX) {
+      product *= ODD_SMALL_PRIMES[last++];
+    }
+
+    auto left = remainder(value, product);
+    for (; first < last; ++first) {
+      if (left % ODD_SMALL_PRIMES[first] == 0) return true;
+    }
+  }
+  return false;
+}
+
+// The modulus must be odd
+int jacobiSymbol(uint64_t value, uint64_t modulus) {
+  value %= modulus;
+  int result = 1;
+  while (value != 0) {
+    while (value % 2 == 0) {
+      value /= 2;
+      if (modulus % 8 == 3 || modulus % 8 == 5) result = -result;
+    }
+    std::swap(value, modulus);
+    if (value % 4 == 3 && modulus % 4 == 3) result = -result;
+    value %= modulus;
+  }
+  return modulus == 1 ? result : 0;
+}
+
+// (d / n) for a small odd d, through quadratic reciprocity, so the only work on the big number is a single remainder
+int jacobiSymbol(intmax_t d, SlicesView n) {
+  auto magnitude = static_cast<uint64_t>(d < 0 ? -d : d);
+  auto nModFour = n.data[0] % 4;
+
+  auto result = jacobiSymbol(remainder(n, magnitude), magnitude);
+  if (magnitude % 4 == 3 && nModFour == 3) result = -result;
+  if (d < 0 && nModFour == 3) result = -result; // (-1 / n)
+  return result;
+}
+
+bool isBitSet(SlicesView value, size_t bit) {
+  return (value.data[bit / SLICE_BITS] >> (bit % SLICE_BITS)) & 1;
+}
+
+// n - 1 = oddPart * 2^twos
+template <typename Context>
+bool isStrongProbablePrimeToBaseTwo(const Context &context, const Integer &oddPart, size_t twos) {
+  auto minusOne = context.subtract(context.subtract(context.one(), context.one()), context.one());
+
+  auto x = context.power(context.add(context.one(), context.one()), oddPart);
+  if (x == context.one() || x == minusOne) return true;
+
+  for (size_t i = 1; i < twos; ++i) {
+    x = context.multiply(x, x);
+    if (x == minusOne) return true;
+    if (x == context.one()) return false; // It's got a square root of 1 that's neither 1 nor -1
+  }
+  return false;
+}
+
+// n + 1 = oddPart * 2^twos, and the Lucas sequences are the ones with P = 1 and Q = (1 - d) / 4
+// Only V is worked out, with the doubling formulas V(2k) = V(k)^2 - 2Q^k and V(2k + 1) = V(k)V(k + 1) - PQ^k, since
+// U(k) is 0 exactly when D * U(k) = 2V(k + 1) - PV(k) is (d and n are coprime, as their Jacobi symbol is -1)
+template <typename Context>
+bool isStrongLucasProbablePrime(const Context &context, intmax_t d, SlicesView oddPart, size_t twos) {
+  auto q = context.toMontgomery(Integer{(1 - d) / 4});
+  auto zero = context.subtract(context.one(), context.one());
+  auto two = context.add(context.one(), context.one());
+
+  // V(k), V(k + 1) and Q^k, starting from k = 0
+  auto v = two;
+  auto next = context.one();
+  auto qk = context.one();
+  for (auto bit = pzl::kernels::bitLength(oddPart); bit-- > 0;) {
+    auto odd = context.subtract(context.multiply(v, next), qk);
+    if (isBitSet(oddPart, bit)) {
+      auto qkNext = context.multiply(qk, q);
+      next = context.subtract(context.multiply(next, next), context.add(qkNext, qkNext));
+      v = odd;
+      qk = context.multiply(qk, qkNext);
+    } else {
+      v = context.subtract(context.multiply(v, v), context.add(qk, qk));
+      next = odd;
+      qk = context.multiply(qk, qk);
+    }
+  }
+
+  if (v == zero || context.add(next, next) == v) return true;
+
+  for (size_t i = 1; i < twos; ++i) {
+    v = context.subtract(context.multiply(v, v), context.add(qk, qk));
+    if (v == zero) return true;
+    qk = context.multiply(qk, qk);
+  }
+  return false;
+}
+
+}
+
+bool pzl::isPrime(const Integer &value) {
+  if (!value.positive() || value.slices.empty()) return false;
+
+  const auto &n = value.slices;
+  if (n.size() == 1 && n[0] < TRIAL_DIVISION_LIMIT) return IS_SMALL_PRIME[n[0]];
+  if (n[0] % 2 == 0 || hasOddSmallFactor(n)) return false;
+  if (n.size() == 1 && n[0] < TRIAL_DIVISION_LIMIT * TRIAL_DIVISION_LIMIT) return true;
+
+  // Selfridge's choice of parameters: the first of 5, -7, 9, -11, ... with a Jacobi symbol of -1, which is never going
+  // to show up for perfect squares
+  if (isPerfectSquare(value)) return false;
+  intmax_t d = 5;
+  for (auto symbol = jacobiSymbol(d, n); symbol != -1; symbol = jacobiSymbol(d, n)) {
+    if (symbol == 0) return false; // We're past the small primes, so |d| is a proper factor
+    d = d > 0 ? -(d + 2) : -d + 2;
+  }
+
+  // Baillie-PSW: there's no composite below 2^64 that passes both tests, and none has been found above that either
+  auto test = [&value, d](const auto &context) {
+    auto nMinusOne = value - 1;
+    auto twos = nMinusOne.countTrailingZeros();
+    if (!isStrongProbablePrimeToBaseTwo(context, nMinusOne >> twos, twos)) return false;
+
+    auto nPlusOne = value + 1;
+    twos = nPlusOne.countTrailingZeros();
+    auto oddPart = nPlusOne >> twos;
+    return isStrongLucasProbablePrime(context, d, oddPart.slices, twos);
+  };
+
+  if (n.size() <= 2) return test(MontgomeryContext64{value});
+  if (n.size() <= 4) return test(MontgomeryContext128{value});
+  return test(MontgomeryContext{value});
+}
+
+Integer pzl::nextPrime(const Integer &value) {
+  if (value < 2) return Integer{2};
+
+  auto candidate = (value + 1) | Integer{1}; // Every prime past 2 is odd
+  while (!isPrime(candidate)) {
+    candidate += 2;
+  }
+  return candidate;
+}
@@ -0,0 +1,301 @@
+/*
+ * Copyright (c) 2026 Emanuel Machado da Silva
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "integer_kernels.h"
+
+#include "common/assertions.h" // ensure
+
+#include <algorithm>   // std::copy
+#include <array>       // std::array
+#include <bit>         // std::endian
+#include <cstring>     // std::memcpy
+#include <optional>    // std::optional
+#include <string_view> // std::string_view
+#include <utility>     // std::move
+
+// Conversions between the binary slices and decimal strings
+// Small numbers go through the schoolbook algorithms, parsing 8 digits at a time and formatting 9 digits at a time;
+// bigger ones are split in halves around a power of 10, so most of the work happens in the subquadratic multiplications
+
+using pzl::kernels::SLICE_BITS;
+using pzl::kernels::SlicesView;
+using pzl::kernels::value_t;
+using pzl::kernels::wide_t;
+
+namespace {
+
+// The biggest power of 10 that fits in a slice
+constexpr value_t CHUNK_BASE = 1000000000;
+constexpr size_t CHUNK_DIGITS = 9;
+
+// How many digits we parse at once, as many as fit in a 64-bit word
+constexpr value_t WORD_BASE = 100000000;
+constexpr size_t WORD_DIGITS = 8;
+
+// Below this many slices, splitting the number costs more than it saves
+constexpr size_t divideAndConquerThreshold = 64;
+
+// Lazily calculates 10^(9 * 2^i), so they can be shared by the whole conversion
+struct PowersOfTen {
+  std::vector<std::vector<value_t>> powers;
+
+  const std::vector<value_t> &get(size_t i) {
+    if (powers.empty()) powers.push_back({CHUNK_BASE});
+
+    while (powers.size() <= i) {
+      const auto &last = powers.back();
+      std::vector<value_t> square(last.size() * 2);
+      pzl::kernels::multiply(last, last, square.data());
+      pzl::kernels::trim(&square);
+      powers.push_back(std::move(square));
+    }
+    return powers[i];
+  }
+
+  // Only worth it for the bigger powers, which are also the ones we divide by over and over
+  const pzl::kernels::ReciprocalDivisor &reciprocal(size_t i) {
+    if (reciprocals.size() <= i) reciprocals.resize(i + 1);
+    if (!reciprocals[i]) reciprocals[i].emplace(get(i));
+    return *reciprocals[i];
+  }
+
+private:
+  std::vector<std::optional<pzl::kernels::ReciprocalDivisor>> reciprocals;
+};
+
+inline size_t digitsOf(size_t power) {
+  return CHUNK_DIGITS << power;
+}
+
+// An upper bound on how many slices a number with that many digits needs, since log2(10) / 32 < 851 / 8192
+inline size_t slicesFor(size_t digits) {
+  return digits * 851 / 8192 + 1;
+}
+
+value_t parseChunk(std::string_view digits) {
+  value_t result = 0;
+  for (auto digit : digits) {
+    ensure(digit >= '0' && digit <= '9');
+    result = result * 10 + static_cast<value_t>(digit - '0');
+  }
+  return result;
+}
+
+// Parsing 8 digits at once, as the bytes of a 64-bit word (SWAR: SIMD within a register)
+inline uint64_t loadWord(const char *digits) {
+  uint64_t word;
+  std::memcpy(&word, digits, sizeof(word));
+  if constexpr (std::endian::native == std::endian::big) {
+    word = __builtin_bswap64(word); // So the first digit is always in the lowest byte
+  }
+  return word;
+}
+
+// Bytes below '0' borrow when subtracting it, and bytes above '9' reach the top bit when adding 0x46 to them
+inline bool isWordOfDigits(uint64_t word) {
+  return (((word - 0x3030303030303030) | (word + 0x4646464646464646)) & 0x8080808080808080) == 0;
+}
+
+inline value_t parseWord(uint64_t word) {
+  word -= 0x3030303030303030;
+
+  // Each step merges neighbouring lanes: digits into 2-digit numbers, then those into 4 digits, and then into 8
+  word = (word * 10 + (word >> 8)) & 0x00FF00FF00FF00FF;
+  word = (word * 100 + (word >> 16)) & 0x0000FFFF0000FFFF;
+  word = (word * 10000 + (word >> 32)) & 0x00000000FFFFFFFF;
+
+  return static_cast<value_t>(word);
+}
+
+// Writes the slices to `out`, which needs room for slicesFor(digits) slices, and returns how many it used
+size_t parseSchoolbook(std::string_view digits, value_t *out) {
+  size_t size = 0;
+
+  // The first chunk takes the leftover digits, so all the others can be read as whole words
+  auto firstChunkSize = digits.size() % WORD_DIGITS;
+  if (firstChunkSize > 0) {
+    out[0] = parseChunk(digits.substr(0, firstChunkSize));
+    size = out[0] != 0;
+  }
+
+  for (auto start = firstChunkSize; start < digits.size(); start += WORD_DIGITS) {
+    auto word = loadWord(digits.data() + start);
+    ensure(isWordOfDigits(word));
+
+    // Making room for the new digits and adding them, in a single pass
+    wide_t carry = parseWord(word);
+    for (size_t i = 0; i < size; ++i) {
+      wide_t current = wide_t{out[i]} * WORD_BASE + carry;
+      out[i] = static_cast<value_t>(current);
+      carry = current >> SLICE_BITS;
+    }
+    if (carry) out[size++] = static_cast<value_t>(carry);
+  }
+
+  return size;
+}
+
+// Same as parseSchoolbook
+size_t parseRecursive(std::string_view digits, value_t *out, PowersOfTen *powers) {
+  if (digits.size() <= divideAndConquerThreshold * CHUNK_DIGITS) {
+    return parseSchoolbook(digits, out);
+  }
+
+  // The low half gets the biggest 9 * 2^k digits that still leave something to the high half
+  size_t power = 0;
+  while (digitsOf(power + 1) < digits.size()) {
+    ++power;
+  }
+
+  // The low half can go straight into the output, the high one still has to be multiplied
+  auto lowDigits = digitsOf(power);
+  auto lowSize = parseRecursive(digits.substr(digits.size() - lowDigits), out, powers);
+
+  auto highDigits = digits.substr(0, digits.size() - lowDigits);
+  std::vector<value_t> high(slicesFor(highDigits.size()));
+  high.resize(parseRecursive(highDigits, high.data(), powers));
+  if (high.empty()) return lowSize;
+
+  const auto &multiplier = powers->get(power);
+  std::vector<value_t> result(high.size() + multiplier.size());
+  pzl::kernels::multiply(high, multiplier, result.data());
+  auto carry = pzl::kernels::addInto(result.data(), result.size(), SlicesView{out, lowSize});
+  ensure(carry == 0);
+
+  auto size = SlicesView{result}.trimmed().size;
+  ensure(size <= slicesFor(digits.size()));
+  std::copy(result.cbegin(), result.cbegin() + static_cast<std::ptrdiff_t>(size), out);
+  return size;
+}
+
+// "00", "01", ... "99", so we can write two digits for each division
+constexpr auto DIGIT_PAIRS = [] {
+  std::array<char, 200> result{};
+  for (size_t i = 0; i < 100; ++i) {
+    result[i * 2] = static_cast<char>('0' + i / 10);
+    result[i * 2 + 1] = static_cast<char>('0' + i % 10);
+  }
+  return result;
+}();
+
+// Writes the digits backwards, ending right before `last`, and padded with zeros to `minimumDigits`
+// Returns where the digits start
+char *writeDigits(value_t value, size_t minimumDigits, char *last) {
+  auto *first = last;
+  while (value >= 100) {
+    auto pair = (value % 100) * 2;
+    value /= 100;
+    *--first = DIGIT_PAIRS[pair + 1];
+    *--first = DIGIT_PAIRS[pair];
+  }
+
+  if (value >= 10) {
+    *--first = DIGIT_PAIRS[value * 2 + 1];
+    *--first = DIGIT_PAIRS[value * 2];
+  } else if (value > 0) {
+    *--first = static_cast<char>('0' + value);
+  }
+
+  while (static_cast<size_t>(last - first) < minimumDigits) {
+    *--first = '0';
+  }
+  return first;
+}
+
+// Same as writeDigits, one 9-digit chunk at a time
+char *formatSchoolbook(SlicesView slices, size_t minimumDigits, char *last) {
+  value_t buffer[divideAndConquerThreshold];
+  std::copy(slices.data, slices.data + slices.size, buffer);
+
+  auto *first = last;
+  auto size = slices.size;
+  while (size > 0) {
+    auto chunk = pzl::kernels::divideBySlice(buffer, size, CHUNK_BASE);
+    while (size > 0 && buffer[size - 1] == 0) {
+      --size;
+    }
+
+    // Every chunk but the top one needs its leading zeros
+    first = writeDigits(chunk, size > 0 ? CHUNK_DIGITS : 0, first);
+  }
+
+  while (static_cast<size_t>(last - first) < minimumDigits) {
+    *--first = '0';
+  }
+  return first;
+}
+
+// Same as writeDigits
+char *formatRecursive(SlicesView slices, size_t minimumDigits, PowersOfTen *powers, char *last) {
+  if (slices.size <= divideAndConquerThreshold) {
+    return formatSchoolbook(slices, minimumDigits, last);
+  }
+
+  // Split around the biggest 10^(9 * 2^k) that's not longer than half of the number
+  size_t power = 0;
+  while (powers->get(power + 1).size() * 2 <= slices.size + 1) {
+    ++power;
+  }
+
+  const auto &divisor = powers->get(power);
+  std::vector<value_t> quotient(slices.size - divisor.size() + 1), remainder(divisor.size());
+  if (divisor.size() < pzl::kernels::RECIPROCAL_DIVISION_THRESHOLD) {
+    pzl::kernels::divide(slices, divisor, quotient.data(), remainder.data());
+  } else {
+    pzl::kernels::divide(slices, powers->reciprocal(power), quotient.data(), remainder.data());
+  }
+
+  // Since we're going backwards, the low half comes first
+  auto lowDigits = digitsOf(power);
+  auto highDigits = minimumDigits > lowDigits ? minimumDigits - lowDigits : 0;
+  auto *middle = formatRecursive(SlicesView{remainder}.trimmed(), lowDigits, powers, last);
+  return formatRecursive(SlicesView{quotient}.trimmed(), highDigits, powers, middle);
+}
+}
+
+pzl::kernels::slices_t pzl::kernels::parseDecimal(std::string_view digits) {
+  slices_t result(slicesFor(digits.size()));
+
+  PowersOfTen powers; // Doesn't allocate anything unless it's actually used
+  result.resize(parseRecursive(digits, result.data(), &powers));
+
+  return result;
+}
+
+size_t pzl::kernels::decimalDigitsBound(SlicesView slices) {
+  if (slices.empty()) return 1;
+
+  // log10(2) < 1234 / 4096
+  return bitLength(slices) * 1234 / 4096 + 1;
+}
+
+char *pzl::kernels::formatDecimal(SlicesView slices, char *last) {
+  ensure(slices.trimmed().size == slices.size);
+
+  if (slices.empty()) {
+    *--last = '0';
+    return last;
+  }
+
+  PowersOfTen powers;
+  return formatRecursive(slices, 0, &powers, last);
+}
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2026 Emanuel Machado da Silva
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "integers.h"
+#include "integer_kernels.h"
+
+#include "common/assertions.h" // ensure
+
+#include <array>   // std::array
+#include <bit>     // std::bit_width
+#include <cmath>   // std::exp2, std::log2
+#include <cstdint> // uint64_t
+#include <utility> // std::move
+
+using pzl::Integer;
+using pzl::kernels::SLICE_BITS;
+using pzl::kernels::SlicesView;
+
+namespace {
+
+// The top 64 bits (or fewer, for smaller numbers) as a double, so it's only approximate
+double leadingBits(SlicesView slices, size_t shift) {
+  auto sliceAt = [&slices](size_t i) { return i < slices.size ? uint64_t{slices.data[i]} : 0; };
+
+  // bitLength - shift is at most 64, so there's at most three slices to look at
+  auto first = shift / SLICE_BITS;
+  auto offset = shift % SLICE_BITS;
+  auto low = (sliceAt(first + 1) << SLICE_BITS) | sliceAt(first);
+  auto bits = offset == 0 ? low : (low >> offset) | (sliceAt(first + 2) << (2 * SLICE_BITS - offset));
+  return static_cast<double>(bits);
+}
+
+// An estimate that's never below the root, but only a few units above it in its top 32 bits, so Newton's iteration
+// takes it the rest of the way in a handful of steps
+Integer estimateRoot(SlicesView slices, size_t degree) {
+  auto bits = pzl::kernels::bitLength(slices);
+  auto shift = bits > 64 ? bits - 64 : 0;
+
+  // root = (n / 2^(scale * degree)) ^ (1 / degree) * 2^scale, where the first factor has about 32 bits
+  auto scale = bits / degree > 32 ? bits / degree - 32 : 0;
+  auto logarithm = std::log2(leadingBits(slices, shift)) + static_cast<double>(shift) -
+                   static_cast<double>(scale * degree);
+  auto estimate = std::exp2(logarithm / static_cast<double>(degree));
+
+  // The double is accurate to way more than 30 bits, so that margin is enough to be sure we're above the root
+  auto top = static_cast<intmax_t>(estimate * (1 + std::exp2(-30))) + 1;
+  return Integer{top} << scale;
+}
+
+// One step of Newton's iteration for value ^ (1 / degree), it never lands below the root (as long as the guess isn't
+// zero), whether it started above or below it
+Integer newtonStep(const Integer &value, size_t degree, const Integer &guess) {
+  // ((degree - 1) * guess + value / guess ^ (degree - 1)) / degree
+  auto next = guess * static_cast<intmax_t>(degree - 1);
+  next += value / guess.power(Integer{static_cast<intmax_t>(degree - 1)});
+  next /= Integer{static_cast<intmax_t>(degree)};
+  return next;
+}
+
+// Newton's iteration for the largest x where x ^ degree <= value, starting from a guess that's not below it; the
+// sequence goes down until it reaches the root, and it stops going down right after that
+Integer newtonRoot(const Integer &value, size_t degree, Integer guess) {
+  while (true) {
+    auto next = newtonStep(value, degree, guess);
+    if (next >= guess) return guess;
+    guess = std::move(next);
+  }
+}
+
+// Which remainders squares can leave, so most non-squares can be ruled out without taking any roots
+template <size_t modulus>
+constexpr std::array<bool, modulus> squaresModulo() {
+  std::array<bool, modulus> result{};
+  for (size_t i = 0; i < modulus; ++i) {
+    result[i * i % modulus] = true;
+  }
+  return result;
+}
+
+constexpr auto SQUARES_MODULO_64 = squaresModulo<64>();
+constexpr auto SQUARES_MODULO_63 = squaresModulo<63>();
+constexpr auto SQUARES_MODULO_65 = squaresModulo<65>();
+constexpr auto SQUARES_MODULO_11 = squaresModulo<11>();
+}
+
+Integer pzl::squareRoot(const Integer &value) {
+  ensure(value.positive()); // The root of a negative number isn't an Integer
+  return nthRoot(value, 2);
+}
+
+Integer pzl::nthRoot(const Integer &value, size_t degree) {
+  ensure(degree > 0);
+  ensure(value.positive() || degree % 2 == 1); // Even roots of negative numbers aren't Integers
+  if (value.slices.empty() || degree == 1) return value;
+
+  if (!value.positive()) {
+    auto root = nthRoot(value.absolute(), degree);
+    root *= -1;
+    return root;
+  }
+
+  // Even 2 ^ degree is too big
+  auto bits = kernels::bitLength(value.slices);
+  if (degree >= bits) return Integer{1};
+
+  // A root that fits in a word is only a couple of steps away from the estimate
+  if (bits <= 64 * degree) return newtonRoot(value, degree, estimateRoot(value.slices, degree));
+
+  // The root of the top bits is less than 2^shift away from this one, which is close enough for a single step of
+  // Newton's iteration to land within a few units of it, so each level costs about one full-size division
+  auto shift = ((bits - 1) / degree - static_cast<size_t>(std::bit_width(degree))) / 2;
+  auto root = newtonStep(value, degree, nthRoot(value >> (shift * degree), degree) << shift);
+
+  // That step can't undershoot
+  const Integer exponent{static_cast<intmax_t>(degree)};
+  while (root.power(exponent) > value) {
+    root -= 1;
+  }
+  return root;
+}
+
+bool pzl::isPerfectSquare(const Integer &value) {
+  if (!value.positive()) return false;
+  if (value.slices.empty()) return true;
+
+  if (!SQUARES_MODULO_64[value.slices[0] % 64]) return false;
+
+  uint64_t remainder = 0; // Modulo 63 * 65 * 11, all at once
+  for (auto i = value.slices.size(); i-- > 0;) {
+    remainder = ((remainder << SLICE_BITS) | value.slices[i]) % (63 * 65 * 11);
+  }
+  if (!SQUARES_MODULO_63[remainder % 63] || !SQUARES_MODULO_65[remainder % 65] || !SQUARES_MODULO_11[remainder % 11]) {
+    return false;
+  }
+
+  auto root = squareRoot(value);
+  return root * root == value;
+}
@@ -25,41 +25,46 @@
 #include "common/assertions.h"
 #include "common/numbers/integer.h"
 
+#include <cstddef> // size_t
+#include <tuple>   // std::tuple
+
 namespace pzl {
 
-inline Integer greatestCommonDivisor(Integer left, Integer right) {
-  // This is the Euclidean algorithm
-  if (left == 0) return right;
+// Always positive (or zero, when both of them are), see integer_gcd.cpp
+Integer greatestCommonDivisor(Integer left, Integer right);
 
-  left = left.absolute();
-  right = right.absolute();
+// Returns the GCD along with Bezout's coefficients for it, x and y, so that left * x + right * y == gcd
+std::tuple<Integer, Integer, Integer> extendedGreatestCommonDivisor(const Integer &left, const Integer &right);
 
-  while (true) {
-    if (right == 0) return left;
-    left %= right;
-    if (left == 0) return right;
-    right %= left;
-  }
-}
+// The largest x where x * x <= value, which can't be negative
+Integer squareRoot(const Integer &value);
+
+// The largest x (in magnitude) where |x ^ degree| <= |value|, with the same sign as value; even roots need a value
+// that's not negative
+Integer nthRoot(const Integer &value, size_t degree);
+
+bool isPerfectSquare(const Integer &value);
+
+// Trial division by the primes below 1000, then the Baillie-PSW test, which is exact for anything below 2^64 and has
+// no known counterexamples above that, see integer_primes.cpp
+bool isPrime(const Integer &value);
+
+// The smallest prime that's bigger than value
+Integer nextPrime(const Integer &value);
+
+// Both of these build the result out of its prime factorization, multiplied together through product trees, see
+// integer_combinatorics.cpp; binomial is zero when k > n
+Integer factorial(size_t n);
+Integer binomial(size_t n, size_t k);
 
 inline Integer lowestCommonMultiple(const Integer &lhs, const Integer &rhs) {
   ensure(lhs != 0 && rhs != 0); // This is undefined
   auto gcd = greatestCommonDivisor(lhs, rhs);
-  return lhs * rhs / gcd;
+  return lhs / gcd * rhs;
 }
 
 inline Integer greatestPowerOfTwo(const Integer &integer) {
   ensure(integer > 0);
-
-  if (integer == 1 || integer == 2) return integer;
-
-  Integer candidate{1};
-  Integer next{2};
-  while (integer >= next) {
-    candidate = next;
-    next = next * 2;
-  }
-
-  return candidate;
+  return Integer{1} << (integer.bitLength() - 1);
 }
 }
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026 Emanuel Machado da Silva
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "common/numbers/integer.h"
+
+#include <array> // std::array
+
+namespace pzl {
+
+// Modular arithmetic against a fixed odd modulus, for when there's lots of it to do; values are kept in Montgomery
+// form (value * R mod modulus, where R = 2^(32 * slices)), where multiplying takes no divisions at all, so the only
+// ones happen when setting up the context and when converting values into it
+// `Storage` holds the residues, it's either Integer::slices_t or, for moduli up to a fixed size, an std::array
+template <typename Storage>
+struct BasicMontgomeryContext {
+  using Residue = Storage;
+
+  // The modulus must be odd, bigger than 1, and fit in the Storage, see fits(); a modulus that's too wide for an
+  // std::array aborts, even in Release builds
+  explicit BasicMontgomeryContext(const Integer &modulus);
+
+  // Whether the modulus has few enough slices for the Storage, which is always the case for Integer::slices_t
+  [[nodiscard]] static bool fits(const Integer &modulus);
+
+  [[nodiscard]] inline const Integer &modulus() const { return _modulus; }
+
+  // Any Integer goes in, even negative ones, and what comes out is always in [0, modulus)
+  [[nodiscard]] Residue toMontgomery(const Integer &value) const;
+  [[nodiscard]] Integer fromMontgomery(const Residue &residue) const;
+
+  // Residues are always fully reduced, so they can be compared with ==
+  [[nodiscard]] inline const Residue &one() const { return _one; }
+  [[nodiscard]] Residue add(const Residue &left, const Residue &right) const;
+  [[nodiscard]] Residue subtract(const Residue &left, const Residue &right) const;
+  [[nodiscard]] Residue multiply(const Residue &left, const Residue &right) const;
+  [[nodiscard]] Residue power(const Residue &base, const Integer &exponent) const;
+
+  // Same as base.powMod(exponent, modulus())
+  [[nodiscard]] inline Integer powMod(const Integer &base, const Integer &exponent) const {
+    return fromMontgomery(power(toMontgomery(base), exponent));
+  }
+
+private:
+  Integer _modulus;
+  Storage modulusSlices;
+  Storage rSquared;         // R^2 mod modulus, multiplying by it takes values into Montgomery form
+  Storage _one;             // R mod modulus
+  Integer::value_t inverse; // -modulus^-1 mod 2^32
+
+  [[nodiscard]] Storage fromInteger(const Integer &reduced) const;
+  // `target` may be the same as `by`, and `scratch` needs room for two more slices than the modulus has
+  void multiplyInPlace(Storage *target, const Storage &by, Integer::value_t *scratch) const;
+};
+
+using MontgomeryContext = BasicMontgomeryContext<Integer::slices_t>;
+
+// Neither setting these up nor working with their residues touches the heap; their loops still run over as many
+// slices as the modulus has, which may be fewer
+using MontgomeryContext64 = BasicMontgomeryContext<std::array<Integer::value_t, 2>>;
+using MontgomeryContext128 = BasicMontgomeryContext<std::array<Integer::value_t, 4>>;
+}
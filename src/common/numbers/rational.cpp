@@ -23,10 +23,12 @@
 #include "rational.h"
 
 #include "common/assertions.h"
-#include "common/numbers/integers.h" // greatestCommonDivisor
+#include "common/numbers/integer_expressions.h" // lazy
+#include "common/numbers/integers.h"            // greatestCommonDivisor, lowestCommonMultiple
 
 using pzl::Integer;
 using pzl::Rational;
+using pzl::expressions::lazy;
 
 Rational::Rational(intmax_t numerator, intmax_t denominator)
     : numerator{numerator}, denominator{std::abs(denominator)} {
@@ -36,29 +38,37 @@ Rational::Rational(intmax_t numerator, intmax_t denominator)
   }
 }
 
-Rational::Rational(Integer numerator, const Integer &denominator)
-    : numerator{std::move(numerator)}, denominator{std::abs(denominator)} {
+Rational::Rational(Integer numerator, Integer denominator) : numerator{std::move(numerator)}, denominator{1} {
   ensure(denominator != 0);
-  if (denominator < 0) {
-    this->numerator *= -1;
+  if (!denominator.positive()) {
+    this->numerator = -std::move(this->numerator);
   }
+  this->denominator = std::abs(std::move(denominator));
 }
 
 Rational Rational::operator+(const Rational &o) const {
-  auto [left, right, denominator] = normalizeDenominatorWith(o);
-  return Rational(left + right, denominator).simplify();
+  if (denominator == o.denominator) return Rational(numerator + o.numerator, denominator).simplify();
+
+  auto commonDenominator = lowestCommonMultiple(denominator, o.denominator);
+  Integer sum = lazy(commonDenominator / denominator) * lazy(numerator) +
+                lazy(commonDenominator / o.denominator) * lazy(o.numerator);
+  return Rational(std::move(sum), std::move(commonDenominator)).simplify();
 }
 
 Rational Rational::operator-(const Rational &o) const {
-  auto [left, right, denominator] = normalizeDenominatorWith(o);
-  return Rational(left - right, denominator).simplify();
+  if (denominator == o.denominator) return Rational(numerator - o.numerator, denominator).simplify();
+
+  auto commonDenominator = lowestCommonMultiple(denominator, o.denominator);
+  Integer difference = lazy(commonDenominator / denominator) * lazy(numerator) -
+                       lazy(commonDenominator / o.denominator) * lazy(o.numerator);
+  return Rational(std::move(difference), std::move(commonDenominator)).simplify();
 }
 
 Rational Rational::operator*(const Rational &o) const {
   auto num = this->numerator * o.numerator;
   auto den = this->denominator * o.denominator;
 
-  return Rational(num, den).simplify();
+  return Rational(std::move(num), std::move(den)).simplify();
 }
 
 Rational Rational::operator/(const Rational &o) const {
@@ -70,26 +80,20 @@ Rational Rational::operator/(const Rational &o) const {
   ensure(this->denominator == 1 && o.denominator == 1); // Haven't implemented this yet
 
   // Now for the actual implementation
-  Integer remainder = this->numerator.absolute();
-  Integer integer(0);
   const auto step = o.numerator.absolute();
-
-  while (remainder >= step) {
-    remainder -= step;
-    ++integer;
-  }
+  auto [integer, remainder] = this->numerator.absolute().divmod(step);
 
   if (remainder == 0) {
     if (positive() != o.positive()) {
-      integer *= -1;
+      integer = -std::move(integer);
     }
-    return Rational(integer);
+    return Rational(std::move(integer));
   } else {
     auto finalNumerator = (integer * step) + remainder;
     if (positive() != o.positive()) {
-      finalNumerator *= -1;
+      finalNumerator = -std::move(finalNumerator);
     }
-    return Rational{finalNumerator, step};
+    return Rational{std::move(finalNumerator), step};
   }
 }
 
@@ -98,69 +102,40 @@ Rational Rational::power(const Rational &exp) const {
   ensure(exp.positive());         // Haven't implemented this yet
   ensure(exp.denominator == 1);   // Haven't implemented this yet
 
-  // Integer power is faster than Rational power
-  if (this->denominator == 1) {
-    auto result = std::pow(this->numerator, exp.numerator);
-    return Rational(result, Integer(1));
-  }
-
-  Rational result(1);
-
-  for (Integer i{0}; i < exp.numerator; ++i) {
-    result *= *this;
-  }
+  // Once the base is simplified, the powers of its numerator and denominator can't have common factors either
+  auto base = *this;
+  base.simplify();
 
-  return result;
+  auto numeratorPower = std::pow(base.numerator, exp.numerator);
+  auto denominatorPower = std::pow(base.denominator, exp.numerator);
+  return Rational(std::move(numeratorPower), std::move(denominatorPower));
 }
 
-bool Rational::operator<(const Rational &o) const {
+compat::strong_ordering Rational::compareTo(const Rational &o) const {
   ensure(this->denominator > 0);
   ensure(o.denominator > 0);
 
   if (this->positive() != o.positive()) {
-    return o.positive();
+    return this->positive() ? compat::strong_ordering::greater : compat::strong_ordering::less;
   }
+  if (this->denominator == o.denominator) return this->numerator.compareTo(o.numerator);
 
-  auto [us, them, _] = normalizeDenominatorWith(o);
-  UNUSED(_);
-
-  return us < them;
-}
-
-bool Rational::operator==(const Rational &o) const {
-  ensure(this->denominator > 0);
-  ensure(o.denominator > 0);
-
-  return this->denominator == o.denominator && this->numerator == o.numerator;
+  // The denominators are positive, so cross-multiplying keeps the order, and it's cheaper than finding their LCM
+  return (this->numerator * o.denominator).compareTo(o.numerator * this->denominator);
 }
 
 std::string Rational::toString() const {
   ensure(denominator > 0);
-  auto result = std::to_string(numerator);
+  auto result = numerator.toString();
 
   if (denominator != 1) {
-    result += "/" + std::to_string(denominator);
+    result += '/';
+    result += denominator.toString();
   }
 
   return result;
 }
 
-std::tuple<Integer, Integer, Integer> Rational::normalizeDenominatorWith(const Rational &o) const {
-  if (denominator == o.denominator) return std::make_tuple(this->numerator, o.numerator, this->denominator);
-
-  auto leftNumerator = this->numerator;
-  auto leftDenominator = this->denominator;
-  auto rightNumerator = o.numerator;
-  auto rightDenominator = o.denominator;
-
-  auto newDenominator = lowestCommonMultiple(leftDenominator, rightDenominator);
-
-  auto left = (newDenominator / leftDenominator) * leftNumerator;
-  auto right = (newDenominator / rightDenominator) * rightNumerator;
-
-  return std::make_tuple(left, right, newDenominator);
-}
-
 Rational &Rational::simplify() {
   if (numerator == 0) {
     denominator = Integer{1};
@@ -23,10 +23,10 @@
 #pragma once
 
 #include "common/numbers/integer.h"
+#include "compat/compare.h" // compat::strong_ordering
 
 #include <cstdint> // intmax_t
 #include <string>
-#include <tuple>
 #include <utility> // std::move
 
 namespace pzl {
@@ -39,7 +39,7 @@ struct Rational {
   Rational(intmax_t numerator, intmax_t denominator);
 
   explicit Rational(pzl::Integer numerator) : numerator{std::move(numerator)}, denominator{1} {}
-  Rational(pzl::Integer numerator, const pzl::Integer &denominator);
+  Rational(pzl::Integer numerator, pzl::Integer denominator);
 
   [[nodiscard]] Rational operator+(const Rational &) const;
   [[nodiscard]] Rational operator-(const Rational &) const;
@@ -52,13 +52,29 @@ struct Rational {
   void operator-=(const Rational &o) { *this = *this - o; }
   void operator*=(const Rational &o) { *this = *this * o; }
 
-  [[nodiscard]] bool operator<(const Rational &) const;
-  // TODO: <= Could be more efficient
-  [[nodiscard]] inline bool operator<=(const Rational &o) const { return *this < o || *this == o; }
-  [[nodiscard]] inline bool operator>=(const Rational &o) const { return o < *this; }
-  [[nodiscard]] bool operator==(const Rational &) const;
+  [[nodiscard]] compat::strong_ordering compareTo(const Rational &) const;
 
-  [[nodiscard]] inline bool operator==(intmax_t o) const { return this->denominator == 1 && this->numerator == o; }
+#ifdef __cpp_lib_three_way_comparison
+  [[nodiscard]] inline std::strong_ordering operator<=>(const Rational &o) const { return compareTo(o); }
+#else
+  [[nodiscard]] inline bool operator<(const Rational &o) const { return compareTo(o) == compat::strong_ordering::less; }
+  [[nodiscard]] inline bool operator<=(const Rational &o) const {
+    return compareTo(o) != compat::strong_ordering::greater;
+  }
+  [[nodiscard]] inline bool operator>(const Rational &o) const {
+    return compareTo(o) == compat::strong_ordering::greater;
+  }
+  [[nodiscard]] inline bool operator>=(const Rational &o) const {
+    return compareTo(o) != compat::strong_ordering::less;
+  }
+#endif
+
+  // Rationals aren't kept simplified, so these compare values, the same as compareTo, rather than fields
+  [[nodiscard]] inline bool operator==(const Rational &o) const {
+    return compareTo(o) == compat::strong_ordering::equal;
+  }
+  [[nodiscard]] inline bool operator!=(const Rational &o) const { return !(*this == o); }
+  [[nodiscard]] inline bool operator==(intmax_t o) const { return this->numerator == this->denominator * o; }
   [[nodiscard]] inline bool operator!=(intmax_t o) const { return !(*this == o); }
 
   [[nodiscard]] std::string toString() const;
@@ -73,7 +89,6 @@ private:
     return *this;
   }
 
-  [[nodiscard]] std::tuple<pzl::Integer, pzl::Integer, pzl::Integer> normalizeDenominatorWith(const Rational &) const;
   [[nodiscard]] inline bool positive() const { return numerator.positive(); }
 
   Rational &simplify();
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2021 Emanuel Machado da Silva
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "compat/defs.h" // pzl_constexpr
+
+#include <algorithm>        // std::copy, std::equal, std::fill, std::max
+#include <array>            // std::array
+#include <cstddef>          // size_t
+#include <cstdint>          // uint32_t
+#include <initializer_list> // std::initializer_list
+#include <type_traits>      // std::is_trivially_copyable_v
+
+namespace Puzzles {
+
+// A std::vector look-alike that keeps up to N values inline, and only goes to the heap when it grows past that
+// It's meant for small trivial values, so it skips constructors and destructors of the values themselves
+// Everything is constexpr where the compiler allows allocating during constant evaluation
+template <typename T, size_t N>
+struct SmallVector {
+  static_assert(std::is_trivially_copyable_v<T>);
+  static_assert(N > 0);
+
+  using value_type = T;
+  using size_type = size_t;
+  using iterator = T *;
+  using const_iterator = const T *;
+
+  static constexpr size_t inlineCapacity = N;
+
+  // Constructors
+  pzl_constexpr SmallVector() = default;
+  pzl_constexpr explicit SmallVector(size_t count, T value = T{}) { resize(count, value); }
+  pzl_constexpr SmallVector(const T *first, const T *last) { assign(first, last); }
+  pzl_constexpr SmallVector(std::initializer_list<T> values) { assign(values.begin(), values.end()); }
+
+  pzl_constexpr SmallVector(const SmallVector &o) { assign(o.begin(), o.end()); }
+  pzl_constexpr SmallVector(SmallVector &&o) noexcept { steal(&o); }
+
+  pzl_constexpr ~SmallVector() { release(); }
+
+  // Operators
+  pzl_constexpr SmallVector &operator=(const SmallVector &o) {
+    if (this != &o) assign(o.begin(), o.end());
+    return *this;
+  }
+
+  pzl_constexpr SmallVector &operator=(SmallVector &&o) noexcept {
+    if (this != &o) {
+      release();
+      steal(&o);
+    }
+    return *this;
+  }
+
+  inline pzl_constexpr bool operator==(const SmallVector &o) const {
+    return std::equal(begin(), end(), o.begin(), o.end());
+  }
+  inline pzl_constexpr bool operator!=(const SmallVector &o) const { return !(*this == o); }
+
+  inline pzl_constexpr T &operator[](size_t i) { return data()[i]; }
+  inline pzl_constexpr const T &operator[](size_t i) const { return data()[i]; }
+
+  // Capacity
+  [[nodiscard]] inline pzl_constexpr size_t size() const { return _size; }
+  [[nodiscard]] inline pzl_constexpr bool empty() const { return _size == 0; }
+  [[nodiscard]] inline pzl_constexpr size_t capacity() const { return _capacity; }
+  [[nodiscard]] inline pzl_constexpr bool isInline() const { return _capacity == N; }
+
+  pzl_constexpr void reserve(size_t newCapacity) {
+    if (newCapacity <= _capacity) return;
+
+    auto *newData = new T[newCapacity];
+    std::copy(begin(), end(), newData);
+    release();
+
+    heapData = newData;
+    _capacity = static_cast<uint32_t>(newCapacity);
+  }
+
+  // Retrieval
+  inline pzl_constexpr T *data() { return isInline() ? inlineData.data() : heapData; }
+  inline pzl_constexpr const T *data() const { return isInline() ? inlineData.data() : heapData; }
+
+  inline pzl_constexpr T &back() { return data()[_size - 1]; }
+  inline pzl_constexpr const T &back() const { return data()[_size - 1]; }
+
+  // Iterators
+  inline pzl_constexpr iterator begin() { return data(); }
+  inline pzl_constexpr iterator end() { return data() + _size; }
+  inline pzl_constexpr const_iterator begin() const { return data(); }
+  inline pzl_constexpr const_iterator end() const { return data() + _size; }
+  inline pzl_constexpr const_iterator cbegin() const { return begin(); }
+  inline pzl_constexpr const_iterator cend() const { return end(); }
+
+  // Modifiers
+  inline pzl_constexpr void push_back(T value) {
+    if (_size == _capacity) reserve(_capacity * 2);
+    data()[_size++] = value;
+  }
+
+  inline pzl_constexpr void pop_back() { --_size; }
+  inline pzl_constexpr void clear() { _size = 0; }
+
+  pzl_constexpr void resize(size_t newSize, T value = T{}) {
+    if (newSize > _capacity) reserve(std::max(newSize, size_t{_capacity} * 2));
+    if (newSize > _size) std::fill(data() + _size, data() + newSize, value);
+    _size = static_cast<uint32_t>(newSize);
+  }
+
+  pzl_constexpr void assign(const T *first, const T *last) {
+    auto count = static_cast<size_t>(last - first);
+    if (count > _capacity) {
+      // Nothing worth keeping, so there's no need to copy the old values over
+      clear();
+      reserve(count);
+    }
+    std::copy(first, last, data());
+    _size = static_cast<uint32_t>(count);
+  }
+
+private:
+  inline pzl_constexpr void release() {
+    if (!isInline()) delete[] heapData;
+    _capacity = N;
+  }
+
+  // Expects to be empty and inline, although the inline storage might not be the active member of the union anymore
+  // Assigning whole arrays to it makes it active again, which constant evaluation insists on
+  inline pzl_constexpr void steal(SmallVector *o) {
+    if (o->isInline()) {
+      inlineData = o->inlineData;
+    } else {
+      heapData = o->heapData;
+      _capacity = o->_capacity;
+      o->_capacity = N;
+      o->inlineData = {};
+    }
+    _size = o->_size;
+    o->_size = 0;
+  }
+
+  union {
+    std::array<T, N> inlineData{};
+    T *heapData;
+  };
+  // 32 bits are plenty for our use cases, and they keep us the same size as a std::vector when N is small
+  uint32_t _size = 0;
+  uint32_t _capacity = N;
+};
+}
@@ -37,3 +37,28 @@
 #define pzl_unlikely
 
 #endif
+
+// Heap allocations during constant evaluation need C++20, so anything that might allocate is only constexpr there
+#if defined(__cpp_constexpr_dynamic_alloc) && defined(__cpp_lib_is_constant_evaluated)
+
+#include <type_traits> // std::is_constant_evaluated
+
+#define pzl_constexpr constexpr
+
+namespace compat {
+constexpr bool isConstantEvaluated() {
+  return std::is_constant_evaluated();
+}
+}
+
+#else
+
+#define pzl_constexpr
+
+namespace compat {
+constexpr bool isConstantEvaluated() {
+  return false;
+}
+}
+
+#endif
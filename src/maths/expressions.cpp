@@ -29,6 +29,7 @@
 #include <cmath>     // std::pow
 #include <cstdint>   // uint_fast8_t
 #include <stack>     // std::stack
+#include <utility>   // std::move
 #include <vector>    // std::vector
 
 using namespace Maths;
@@ -56,7 +57,7 @@ vector<Token> Maths::tokenizeExpression(const string &expression) {
     }
 
     if (currentNumber != 0) {
-      tokens.emplace_back(currentNumber);
+      tokens.emplace_back(std::move(currentNumber));
       isReadingNumber = false;
       currentNumber = Rational(0);
     }
@@ -65,7 +66,7 @@ vector<Token> Maths::tokenizeExpression(const string &expression) {
   }
 
   if (isReadingNumber) {
-    tokens.emplace_back(currentNumber);
+    tokens.emplace_back(std::move(currentNumber));
   }
 
   return tokens;
@@ -88,9 +89,9 @@ void reduceOnce(stack<Rational> *numbers, stack<char> *operators) {
   ensure(std::string("+-*/^").find(next) != std::string::npos);
 
   ensure(numbers->size() >= 2);
-  auto right = numbers->top();
+  auto right = std::move(numbers->top());
   numbers->pop();
-  auto left = numbers->top();
+  auto left = std::move(numbers->top());
   numbers->pop();
 
   if (next == '+') {
@@ -137,11 +138,11 @@ Rational Maths::evaluateExpression(std::string expression) {
   int parenthesisCount = 0;
   bool isLastTokenAnOperator = false;
 
-  for (const auto &token : tokenizeExpression(expression)) {
+  for (auto &token : tokenizeExpression(expression)) {
     ensure(token != ' ');
 
     if (token.isNumber) {
-      numbers.push(token.asNumber);
+      numbers.push(std::move(token.asNumber));
     } else if (token == '(') {
       operators.push('(');
       parenthesisCount++;
@@ -167,5 +168,5 @@ Rational Maths::evaluateExpression(std::string expression) {
   }
 
   ensure(numbers.size() == 1);
-  return numbers.top();
+  return std::move(numbers.top());
 }
@@ -23,14 +23,18 @@
 #include "solver.h"
 
 #include "common/assertions.h"
+#include "common/numbers/integer_expressions.h"
 #include "common/numbers/integers.h"
 
+#include <utility> // std::move
+
 using namespace Maths::Josephus;
 using pzl::Integer;
+using pzl::expressions::lazy;
 
 Integer ArithmeticSolver::solve(const Integer &initialSize) {
   ensure(initialSize > 0);
   auto n = pzl::greatestPowerOfTwo(initialSize);
   auto l = initialSize - n;
-  return l * 2 + 1;
+  return lazy(std::move(l)) * 2 + 1;
 }
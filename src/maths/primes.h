@@ -32,7 +32,8 @@ constexpr bool isPrime(uintmax_t n) {
 
   if (n % 2 == 0) return false;
 
-  for (auto i = 3u; i < (n / 2); i += 2) {
+  // Any factor bigger than the square root comes with a smaller one
+  for (uintmax_t i = 3; i <= n / i; i += 2) {
     if (n % i == 0) return false;
   }
 
@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2026 Emanuel Machado da Silva
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "common/numbers/fixed_integer.h"
+
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <random>
+#include <string>
+
+using pzl::FixedInteger;
+using pzl::Integer;
+
+namespace {
+
+// Random values of up to `bits` bits, about half of them negative
+Integer randomInteger(std::mt19937_64 *engine, size_t bits) {
+  Integer result{0};
+  for (size_t i = 0; i < bits; i += 32) {
+    result = (result << 32) + static_cast<intmax_t>((*engine)() & 0xFFFFFFFF);
+  }
+  result >>= (*engine)() % bits;
+  return (*engine)() % 2 ? result : -result;
+}
+
+// Checks every operation against plain Integer arithmetic, with operands small enough that the results always fit
+template <size_t Bits>
+void expectSameAsIntegers() {
+  std::mt19937_64 engine{Bits};
+
+  for (auto i = 0; i < 200; ++i) {
+    auto left = randomInteger(&engine, Bits / 2 - 1);
+    auto right = randomInteger(&engine, Bits / 2 - 1);
+    if (right == 0) right = Integer{1};
+    auto fixedLeft = *FixedInteger<Bits>::from(left);
+    auto fixedRight = *FixedInteger<Bits>::from(right);
+
+    EXPECT_EQ(fixedLeft.toInteger(), left);
+    EXPECT_EQ((fixedLeft + fixedRight).toInteger(), left + right);
+    EXPECT_EQ((fixedLeft - fixedRight).toInteger(), left - right);
+    EXPECT_EQ((fixedLeft * fixedRight).toInteger(), left * right);
+    EXPECT_EQ((fixedLeft / fixedRight).toInteger(), left / right);
+    EXPECT_EQ((fixedLeft % fixedRight).toInteger(), left % right);
+    EXPECT_EQ((fixedLeft << 3).toInteger(), left << 3);
+    EXPECT_EQ((fixedLeft >> 37).toInteger(), left >> 37);
+    EXPECT_EQ(fixedLeft.compareTo(fixedRight), left.compareTo(right));
+    EXPECT_EQ(fixedLeft.bitLength(), left.bitLength());
+    EXPECT_EQ(fixedLeft.popCount(), left.popCount());
+    EXPECT_EQ(fixedLeft.toString(), left.toString());
+  }
+}
+}
+
+TEST(FixedInteger, SameAsIntegers) {
+  expectSameAsIntegers<64>();
+  expectSameAsIntegers<128>();
+  expectSameAsIntegers<256>();
+  expectSameAsIntegers<1024>();
+}
+
+TEST(FixedInteger, Conversions) {
+  EXPECT_EQ(FixedInteger<64>{INTMAX_MIN}.toInteger(), Integer{INTMAX_MIN});
+  EXPECT_EQ(FixedInteger<64>{-1}.toString(), "-1");
+  EXPECT_EQ(std::to_string(FixedInteger<96>{0}), "0");
+
+  Integer big{"340282366920938463463374607431768211455"}; // 2^128 - 1
+  EXPECT_TRUE(FixedInteger<128>::fits(big));
+  EXPECT_TRUE(FixedInteger<128>::fits(-big));
+  EXPECT_FALSE(FixedInteger<128>::fits(big + 1));
+  EXPECT_FALSE(FixedInteger<64>::fits(big));
+  EXPECT_EQ(FixedInteger<128>::from(-big)->toInteger(), -big);
+  EXPECT_EQ(FixedInteger<192>::from(big)->toInteger(), big);
+  EXPECT_EQ(FixedInteger<128>::from(big + 1), std::nullopt);
+  EXPECT_EQ(FixedInteger<64>::from(-big), std::nullopt);
+}
+
+TEST(FixedInteger, ComparisonsWithScalars) {
+  // The scalars don't need to fit in Bits
+  EXPECT_TRUE(FixedInteger<32>{1} < (INTMAX_C(1) << 40));
+  EXPECT_TRUE(FixedInteger<32>{-1} > -(INTMAX_C(1) << 40));
+  EXPECT_TRUE(FixedInteger<32>{0} > INTMAX_MIN);
+  EXPECT_TRUE(FixedInteger<32>{0xFFFFFFFF} < INTMAX_MAX);
+  EXPECT_TRUE(FixedInteger<32>{0xFFFFFFFF} == 0xFFFFFFFF);
+  EXPECT_TRUE(FixedInteger<32>{0xFFFFFFFF} != 0x1FFFFFFFF);
+
+  EXPECT_TRUE(FixedInteger<64>{INTMAX_MIN} == INTMAX_MIN);
+  EXPECT_TRUE(FixedInteger<64>{INTMAX_MIN} < INTMAX_MIN + 1);
+  EXPECT_TRUE(FixedInteger<128>{1} << 64 > INTMAX_MAX);
+  EXPECT_TRUE(-(FixedInteger<128>{1} << 64) < INTMAX_MIN);
+  EXPECT_TRUE(FixedInteger<128>{-3} < -2);
+  EXPECT_TRUE(FixedInteger<128>{-3} > -4);
+  EXPECT_TRUE(FixedInteger<128>{0} == 0);
+}
+
+TEST(FixedInteger, OverflowDetection) {
+  auto max = FixedInteger<64>{INTMAX_MAX} * 2 + 1; // 2^64 - 1
+
+  auto sum = max;
+  EXPECT_FALSE(sum.tryAdd(FixedInteger<64>{1}));
+  EXPECT_EQ(sum, max); // Left untouched
+  EXPECT_TRUE(sum.tryAdd(FixedInteger<64>{-1}));
+  EXPECT_EQ(sum + 1, max);
+
+  auto difference = -max;
+  EXPECT_FALSE(difference.trySubtract(FixedInteger<64>{1}));
+  EXPECT_TRUE(difference.trySubtract(-max));
+  EXPECT_EQ(difference, 0);
+
+  auto product = FixedInteger<64>{0xFFFFFFFF};
+  EXPECT_TRUE(product.tryMultiply(FixedInteger<64>{0x100000001}));
+  EXPECT_EQ(product, max);
+  EXPECT_FALSE(product.tryMultiply(FixedInteger<64>{2}));
+  EXPECT_FALSE(FixedInteger<64>{0x100000000}.tryMultiply(FixedInteger<64>{0x100000000}));
+  EXPECT_TRUE(FixedInteger<64>{0}.tryMultiply(max));
+
+  auto power = FixedInteger<64>{3};
+  EXPECT_FALSE(power.tryPower(FixedInteger<64>{41}));
+  EXPECT_EQ(power, 3);
+  EXPECT_TRUE(power.tryPower(FixedInteger<64>{40}));
+  EXPECT_EQ(power.toInteger(), Integer{3}.power(Integer{40}));
+
+  // The way to carry on once we're past the bound
+  auto factorial = FixedInteger<64>{1};
+  Integer promoted{0};
+  for (intmax_t i = 2; i <= 25; ++i) {
+    if (!factorial.tryMultiply(FixedInteger<64>{i})) {
+      promoted = factorial.toInteger() * i;
+      for (++i; i <= 25; ++i) {
+        promoted *= i;
+      }
+    }
+  }
+  EXPECT_EQ(promoted.toString(), "15511210043330985984000000");
+}
+
+TEST(FixedInteger, Division) {
+  // Truncated, the same as Integer
+  EXPECT_EQ(FixedInteger<64>{7} / FixedInteger<64>{-2}, -3);
+  EXPECT_EQ(FixedInteger<64>{-7} % FixedInteger<64>{2}, -1);
+  EXPECT_EQ(FixedInteger<64>{-6} % FixedInteger<64>{2}, 0);
+  EXPECT_TRUE((FixedInteger<64>{-6} % FixedInteger<64>{2}).positive());
+  EXPECT_EQ(FixedInteger<64>{3} / FixedInteger<64>{INTMAX_MAX}, 0);
+
+  auto [quotient, remainder] = (FixedInteger<128>{1} << 127).divmod(FixedInteger<128>{INTMAX_MAX});
+  EXPECT_EQ(quotient.toInteger(), (Integer{1} << 127) / Integer{INTMAX_MAX});
+  EXPECT_EQ(remainder.toInteger(), (Integer{1} << 127) % Integer{INTMAX_MAX});
+}
+
+TEST(FixedInteger, Shifts) {
+  EXPECT_EQ((FixedInteger<128>{1} << 127).toInteger(), Integer{1} << 127);
+  EXPECT_EQ((FixedInteger<128>{1} << 127) >> 127, 1);
+  EXPECT_EQ(FixedInteger<128>{-5} >> 1, -3);
+  EXPECT_EQ(FixedInteger<128>{-4} >> 1, -2);
+  EXPECT_EQ(FixedInteger<128>{-1} >> 100, -1);
+  EXPECT_EQ(FixedInteger<128>{5} >> 100, 0);
+  EXPECT_EQ((FixedInteger<128>{3} << 64).countTrailingZeros(), 64);
+}
+
+TEST(FixedInteger, Power) {
+  EXPECT_EQ(FixedInteger<128>{3}.power(FixedInteger<128>{80}).toInteger(), Integer{3}.power(Integer{80}));
+  EXPECT_EQ(FixedInteger<64>{-2}.power(FixedInteger<64>{63}), INTMAX_MIN);
+  EXPECT_EQ(FixedInteger<64>{5}.power(FixedInteger<64>{0}), 1);
+}
+
+TEST(FixedInteger, ConstantEvaluation) {
+  constexpr auto factorial = [] {
+    FixedInteger<128> result{1};
+    for (intmax_t i = 2; i <= 30; ++i) {
+      if (!result.tryMultiply(FixedInteger<128>{i})) return FixedInteger<128>{0};
+    }
+    return result;
+  }();
+  static_assert(factorial > FixedInteger<128>{INTMAX_MAX});
+  static_assert((factorial << 1) - factorial == factorial);
+  EXPECT_EQ(factorial.toString(), "265252859812191058636308480000000");
+}
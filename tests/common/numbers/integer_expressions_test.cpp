@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2026 Emanuel Machado da Silva
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "common/numbers/integer_expressions.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+using pzl::Integer;
+using pzl::expressions::lazy;
+
+namespace {
+
+// Small and big, positive and negative, and zero
+std::vector<Integer> operands() {
+  Integer big{"123456789012345678901234567890123456789"};
+  return {Integer{0}, Integer{1}, Integer{-1}, Integer{4294967295}, Integer{-4294967296}, big, -big, big * big};
+}
+
+std::vector<intmax_t> scalars() {
+  return {0, 1, -1, 2, -3, 4294967295, -4294967295, 4294967296, INTMAX_MAX, INTMAX_MIN};
+}
+}
+
+TEST(IntegerExpressions, MultiplyAdd) {
+  for (const auto &a : operands()) {
+    for (const auto &b : operands()) {
+      for (const auto &c : operands()) {
+        SCOPED_TRACE(std::to_string(a) + ", " + std::to_string(b) + ", " + std::to_string(c));
+
+        EXPECT_EQ(Integer{lazy(a) * lazy(b) + lazy(c)}, a * b + c);
+        EXPECT_EQ(Integer{lazy(a) * lazy(b) - lazy(c)}, a * b - c);
+        EXPECT_EQ(Integer{lazy(c) + lazy(a) * lazy(b)}, c + a * b);
+        EXPECT_EQ(Integer{lazy(c) - lazy(a) * lazy(b)}, c - a * b);
+      }
+    }
+  }
+}
+
+TEST(IntegerExpressions, MultiplyAdd_Scalars) {
+  for (const auto &a : operands()) {
+    for (auto m : scalars()) {
+      for (auto n : scalars()) {
+        SCOPED_TRACE(std::to_string(a) + ", " + std::to_string(m) + ", " + std::to_string(n));
+        auto product = a * Integer{m};
+
+        EXPECT_EQ(Integer{lazy(a) * m + n}, product + Integer{n});
+        EXPECT_EQ(Integer{m * lazy(a) + n}, product + Integer{n});
+        EXPECT_EQ(Integer{n + lazy(Integer{a}) * m}, product + Integer{n});
+        EXPECT_EQ(Integer{lazy(Integer{a}) * m - n}, product - Integer{n});
+        EXPECT_EQ(Integer{n - lazy(a) * m}, Integer{n} - product);
+      }
+    }
+  }
+}
+
+TEST(IntegerExpressions, OtherShapes) {
+  Integer a{"98765432109876543210"};
+  Integer b{-12345};
+  Integer c{"-5555555555555555555555555"};
+
+  EXPECT_EQ(Integer{lazy(a) + lazy(b) - lazy(c)}, a + b - c);
+  EXPECT_EQ(Integer{lazy(a) * lazy(b) * lazy(c)}, a * b * c);
+  EXPECT_EQ(Integer{lazy(a) * lazy(b) + lazy(c) * lazy(a)}, a * b + c * a);
+  EXPECT_EQ(Integer{lazy(a) * lazy(b) * 3 + 7}, a * b * 3 + 7);
+  EXPECT_EQ(Integer{(lazy(a) + 1) * (lazy(b) - 1) + lazy(c)}, (a + 1) * (b - 1) + c);
+  EXPECT_EQ(Integer{1 - lazy(a)}, Integer{1} - a);
+  EXPECT_EQ(Integer{lazy(a) - 1}, a - 1);
+  EXPECT_EQ(Integer{lazy(a) * 5}, a * 5);
+
+  // The same Integer in several places
+  EXPECT_EQ(Integer{lazy(a) * lazy(a) - lazy(a)}, a * a - a);
+}
+
+TEST(IntegerExpressions, ReusesTemporaries) {
+  Integer big{1};
+  big <<= 1000;
+  auto expected = big * 3 + 1;
+
+  Integer result = lazy(std::move(big)) * 3 + 1;
+  EXPECT_EQ(result, expected);
+}
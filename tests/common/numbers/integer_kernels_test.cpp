@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2026 Emanuel Machado da Silva
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "common/numbers/integer_kernels.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <random>
+
+using namespace pzl::kernels;
+
+std::vector<value_t> randomSlices(size_t size, std::mt19937 *engine) {
+  std::uniform_int_distribution<value_t> distribution{0, SLICE_MAX};
+
+  std::vector<value_t> result(size);
+  for (auto &slice : result) {
+    slice = distribution(*engine);
+  }
+
+  return result;
+}
+
+template <typename function>
+std::vector<value_t> multiplyWith(function multiplication, const std::vector<value_t> &left,
+                                  const std::vector<value_t> &right) {
+  std::vector<value_t> result(left.size() + right.size());
+  multiplication(left, right, result.data());
+  return result;
+}
+
+TEST(IntegerKernels, AddAndSubtract) {
+  std::vector<value_t> target{SLICE_MAX, SLICE_MAX, 0};
+  std::vector<value_t> one{1};
+
+  EXPECT_EQ(addInto(target.data(), target.size(), one), 0u);
+  EXPECT_EQ(target, (std::vector<value_t>{0, 0, 1}));
+
+  EXPECT_EQ(subtractFrom(target.data(), target.size(), one), 0u);
+  EXPECT_EQ(target, (std::vector<value_t>{SLICE_MAX, SLICE_MAX, 0}));
+
+  std::vector<value_t> full{SLICE_MAX};
+  EXPECT_EQ(addInto(full.data(), full.size(), one), 1u);
+  EXPECT_EQ(subtractFrom(full.data(), full.size(), one), 1u);
+
+  std::vector<value_t> small{1, 0}, big{0, 1};
+  EXPECT_EQ(subtractReversed(small.data(), small.size(), big), 0u);
+  EXPECT_EQ(small, (std::vector<value_t>{SLICE_MAX, 0}));
+  EXPECT_EQ(subtractReversed(big.data(), big.size(), small), 1u);
+}
+
+TEST(IntegerKernels, AddAndSubtract_Long) {
+  std::mt19937 engine{2468};
+
+  // Long runs of all ones and all zeroes make carries and borrows ripple across several slices, and vectors
+  auto left = randomSlices(101, &engine);
+  auto right = randomSlices(37, &engine);
+  std::fill(left.begin() + 3, left.begin() + 30, SLICE_MAX);
+  std::fill(left.begin() + 40, left.begin() + 60, 0);
+  right[2] = SLICE_MAX;
+  left[2] = 1;
+
+  // The slow but obvious way, one slice and one carry at a time
+  auto expected = left;
+  wide_t carry = 0;
+  for (size_t i = 0; i < expected.size(); ++i) {
+    wide_t sum = wide_t{expected[i]} + (i < right.size() ? right[i] : 0) + carry;
+    expected[i] = static_cast<value_t>(sum);
+    carry = sum >> SLICE_BITS;
+  }
+
+  auto target = left;
+  EXPECT_EQ(addInto(target.data(), target.size(), right), carry);
+  EXPECT_EQ(target, expected);
+
+  EXPECT_EQ(subtractFrom(target.data(), target.size(), right), carry);
+  EXPECT_EQ(target, left);
+}
+
+TEST(IntegerKernels, CompareToScalar) {
+  std::vector<value_t> empty{}, small{5}, big{0, 1}, huge{0, 0, 1};
+
+  EXPECT_EQ(compareToScalar(empty, 0), compat::strong_ordering::equal);
+  EXPECT_EQ(compareToScalar(empty, 1), compat::strong_ordering::less);
+  EXPECT_EQ(compareToScalar(small, 5), compat::strong_ordering::equal);
+  EXPECT_EQ(compareToScalar(small, 4), compat::strong_ordering::greater);
+  EXPECT_EQ(compareToScalar(big, uintmax_t{1} << 32), compat::strong_ordering::equal);
+  EXPECT_EQ(compareToScalar(big, (uintmax_t{1} << 32) + 1), compat::strong_ordering::less);
+  EXPECT_EQ(compareToScalar(huge, std::numeric_limits<uintmax_t>::max()), compat::strong_ordering::greater);
+}
+
+TEST(IntegerKernels, DivideBySlice) {
+  std::vector<value_t> slices{7, 1}; // 4294967303
+  EXPECT_EQ(divideBySlice(slices.data(), slices.size(), 2), 1u);
+  EXPECT_EQ(slices, (std::vector<value_t>{2147483651, 0}));
+}
+
+TEST(IntegerKernels, MultiplyAddBySlice) {
+  std::vector<value_t> slices{SLICE_MAX, SLICE_MAX};
+  std::vector<value_t> out(2);
+
+  // (2^64 - 1) * (2^32 - 1) + (2^32 - 1) = 2^96 - 2^64
+  EXPECT_EQ(multiplyAddBySlice(slices.data(), slices.size(), SLICE_MAX, SLICE_MAX, out.data()), SLICE_MAX);
+  EXPECT_EQ(out, (std::vector<value_t>{0, 0}));
+
+  // In place, with the addend rippling all the way up
+  EXPECT_EQ(multiplyAddBySlice(slices.data(), slices.size(), 1, 1, slices.data()), 1u);
+  EXPECT_EQ(slices, (std::vector<value_t>{0, 0}));
+}
+
+TEST(IntegerKernels, MultiplicationAlgorithmsAgree) {
+  std::mt19937 engine{1234};
+  auto originalThresholds = multiplicationThresholds;
+  multiplicationThresholds = {4, 12, 60};
+
+  for (auto [leftSize, rightSize] : {std::pair{5, 5}, {13, 12}, {40, 40}, {41, 29}, {100, 99}, {150, 150}}) {
+    auto left = randomSlices(static_cast<size_t>(leftSize), &engine);
+    auto right = randomSlices(static_cast<size_t>(rightSize), &engine);
+
+    auto expected = multiplyWith(multiplySchoolbook, left, right);
+    EXPECT_EQ(multiplyWith(multiplyKaratsuba, left, right), expected) << leftSize << "x" << rightSize;
+    EXPECT_EQ(multiplyWith(multiplyToomCook3, left, right), expected) << leftSize << "x" << rightSize;
+    EXPECT_EQ(multiplyWith(multiplyNumberTheoretic, left, right), expected) << leftSize << "x" << rightSize;
+    EXPECT_EQ(multiplyWith(multiply, left, right), expected) << leftSize << "x" << rightSize;
+  }
+
+  // Unbalanced operands get split in chunks
+  auto left = randomSlices(200, &engine);
+  auto right = randomSlices(30, &engine);
+  EXPECT_EQ(multiplyWith(multiply, left, right), multiplyWith(multiplySchoolbook, left, right));
+
+  // The NTT skips one of the transforms when squaring
+  EXPECT_EQ(multiplyWith(multiplyNumberTheoretic, left, left), multiplyWith(multiplySchoolbook, left, left));
+
+  // Worst case for the CRT reconstruction
+  std::vector<value_t> nines(3000, SLICE_MAX);
+  EXPECT_EQ(multiplyWith(multiplyNumberTheoretic, nines, nines), multiplyWith(multiplyKaratsuba, nines, nines));
+
+  multiplicationThresholds = originalThresholds;
+}
+
+TEST(IntegerKernels, DivisionRebuildsTheDividend) {
+  std::mt19937 engine{4321};
+
+  for (auto [dividendSize, divisorSize] : {std::pair{1, 1}, {5, 1}, {2, 2}, {7, 3}, {40, 17}, {100, 99}, {64, 32},
+                                                      // Large enough to divide through the reciprocal
+                                                      {1100, 520}, {2500, 1200}}) {
+    auto dividend = randomSlices(static_cast<size_t>(dividendSize), &engine);
+    auto divisor = randomSlices(static_cast<size_t>(divisorSize), &engine);
+    dividend.back() = std::max(dividend.back(), 1u);
+    divisor.back() = std::max(divisor.back(), 1u);
+
+    std::vector<value_t> quotient(dividend.size() - divisor.size() + 1), remainder(divisor.size());
+    divide(dividend, divisor, quotient.data(), remainder.data());
+
+    EXPECT_EQ(compare(SlicesView{remainder}.trimmed(), divisor), compat::strong_ordering::less);
+
+    auto rebuilt = multiplyWith(multiply, quotient, divisor);
+    EXPECT_EQ(addInto(rebuilt.data(), rebuilt.size(), remainder), 0u);
+    rebuilt.resize(dividend.size());
+    EXPECT_EQ(rebuilt, dividend) << dividendSize << "/" << divisorSize;
+  }
+
+  // Divisors that force the quotient estimate to be corrected
+  std::vector<value_t> dividend{0, 0, 0, SLICE_MAX / 2}, divisor{1, 0, SLICE_MAX / 2 + 1};
+  std::vector<value_t> quotient(2), remainder(3);
+  divide(dividend, divisor, quotient.data(), remainder.data());
+  auto rebuilt = multiplyWith(multiply, quotient, divisor);
+  addInto(rebuilt.data(), rebuilt.size(), remainder);
+  rebuilt.resize(dividend.size());
+  EXPECT_EQ(rebuilt, dividend);
+}
+
+TEST(IntegerKernels, DivisionByLargeRoundDivisors) {
+  // The reciprocal's extremes: a power of two, and all ones, against dividends that are all ones
+  std::vector<value_t> powerOfTwo(600, 0), allOnes(600, SLICE_MAX);
+  powerOfTwo.back() = 1u << (SLICE_BITS - 1);
+
+  for (const auto &divisor : {powerOfTwo, allOnes}) {
+    std::vector<value_t> dividend(1500, SLICE_MAX);
+    std::vector<value_t> quotient(dividend.size() - divisor.size() + 1), remainder(divisor.size());
+    divide(dividend, divisor, quotient.data(), remainder.data());
+
+    EXPECT_EQ(compare(SlicesView{remainder}.trimmed(), divisor), compat::strong_ordering::less);
+
+    auto rebuilt = multiplyWith(multiply, quotient, divisor);
+    EXPECT_EQ(addInto(rebuilt.data(), rebuilt.size(), remainder), 0u);
+    rebuilt.resize(dividend.size());
+    EXPECT_EQ(rebuilt, dividend);
+  }
+}
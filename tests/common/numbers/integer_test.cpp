@@ -24,7 +24,10 @@
 
 #include <gtest/gtest.h>
 
+#include <charconv> // std::errc
+
 using pzl::Integer;
+using namespace pzl::literals;
 
 TEST(Integer, CreateFromString) {
   EXPECT_EQ(std::to_string(Integer{"-1"}), "-1");
@@ -33,6 +36,42 @@ TEST(Integer, CreateFromString) {
 
   EXPECT_EQ(std::to_string(Integer{"137415147537554114372745478463741"}), "137415147537554114372745478463741");
   EXPECT_EQ(std::to_string(Integer{"1354645611354413541715318441313195"}), "1354645611354413541715318441313195");
+
+  EXPECT_EQ(std::to_string(Integer{"4294967295"}), "4294967295");
+  EXPECT_EQ(std::to_string(Integer{"4294967296"}), "4294967296");
+  EXPECT_EQ(std::to_string(Integer{"-000123"}), "-123");
+  EXPECT_EQ(std::to_string(Integer{"-0"}), "0");
+}
+
+TEST(Integer, CreateFromString_Big) {
+  std::string digits;
+  for (auto i = 0; i < 5000; ++i) {
+    digits += static_cast<char>('0' + (i * 7 + 3) % 10);
+  }
+  EXPECT_EQ(std::to_string(Integer{digits}), digits);
+  EXPECT_EQ(std::to_string(Integer{"-" + digits}), "-" + digits);
+
+  std::string powerOfTen = "1" + std::string(3000, '0');
+  EXPECT_EQ(std::to_string(Integer{powerOfTen}), powerOfTen);
+  EXPECT_EQ(std::to_string(Integer{powerOfTen} - Integer{1}), std::string(3000, '9'));
+}
+
+TEST(Integer, CreateFromString_EveryLength) {
+  // Digits get parsed in 8-digit words, plus whatever is left over
+  std::string digits;
+  Integer expected{0};
+  for (auto i = 0; i < 100; ++i) {
+    auto digit = (i * 7 + 3) % 10;
+    digits += static_cast<char>('0' + digit);
+    expected = expected * 10 + digit;
+
+    EXPECT_EQ(Integer{digits}, expected) << digits;
+    EXPECT_EQ(Integer{"-" + digits}, expected * -1) << digits;
+  }
+
+  EXPECT_EQ(Integer{"00000000000000000000000000000000000012"}, Integer{12});
+  EXPECT_EQ(Integer{"99999999"}, Integer{99999999});
+  EXPECT_EQ(Integer{"18446744073709551615"}, Integer{"18446744073709551616"} - 1);
 }
 
 TEST(Integer, CreateFromInt) {
@@ -55,6 +94,33 @@ TEST(Integer, CreateFromInt) {
 
   constexpr intmax_t max = std::numeric_limits<intmax_t>::max();
   EXPECT_EQ(std::to_string(Integer{max}), std::to_string(max));
+  constexpr intmax_t min = std::numeric_limits<intmax_t>::min();
+  EXPECT_EQ(std::to_string(Integer{min}), std::to_string(min));
+}
+
+TEST(Integer, ToChars) {
+  char buffer[32];
+
+  auto result = Integer{-1234567890123}.toChars(buffer, buffer + sizeof(buffer));
+  EXPECT_EQ(result.ec, std::errc{});
+  EXPECT_EQ(std::string(buffer, result.ptr), "-1234567890123");
+
+  result = Integer{"1000000000000000000000"}.toChars(buffer, buffer + 22);
+  EXPECT_EQ(result.ec, std::errc{});
+  EXPECT_EQ(std::string(buffer, result.ptr), "1000000000000000000000");
+
+  // There's room for the digits, even if the estimate says otherwise
+  result = Integer{999}.toChars(buffer, buffer + 3);
+  EXPECT_EQ(result.ec, std::errc{});
+  EXPECT_EQ(std::string(buffer, result.ptr), "999");
+
+  result = Integer{0}.toChars(buffer, buffer + 1);
+  EXPECT_EQ(result.ec, std::errc{});
+  EXPECT_EQ(std::string(buffer, result.ptr), "0");
+
+  result = Integer{-10}.toChars(buffer, buffer + 2);
+  EXPECT_EQ(result.ec, std::errc::value_too_large);
+  EXPECT_EQ(result.ptr, buffer + 2);
 }
 
 TEST(Integer, Addition) {
@@ -153,6 +219,10 @@ TEST(Integer, Addition_Int) {
   EXPECT_EQ(std::to_string(bigNumber + 1), "1234567891");
   EXPECT_EQ(std::to_string(bigNumber + 5), "1234567895");
   EXPECT_EQ(std::to_string(bigNumber + 1234567890), "2469135780");
+
+  EXPECT_EQ(std::to_string(five + INTMAX_MIN), "-9223372036854775803");
+  EXPECT_EQ(std::to_string(negativeFive + INTMAX_MIN), "-9223372036854775813");
+  EXPECT_EQ(std::to_string(zero + INTMAX_MIN), "-9223372036854775808");
 }
 
 TEST(Integer, Subtraction) {
@@ -179,6 +249,14 @@ TEST(Integer, Subtraction) {
   EXPECT_EQ(std::to_string(one - five), "-4");
 
   EXPECT_EQ(std::to_string(negativeFive - negativeFive), "0");
+
+  EXPECT_EQ(std::to_string(five - 7), "-2");
+  EXPECT_EQ(std::to_string(negativeFive - (-7)), "2");
+  EXPECT_EQ(std::to_string(negativeFive - 7), "-12");
+  EXPECT_EQ(std::to_string(zero - 5), "-5");
+  EXPECT_EQ(std::to_string(five - INTMAX_MIN), "9223372036854775813");
+  EXPECT_EQ(std::to_string(negativeFive - INTMAX_MIN), "9223372036854775803");
+  EXPECT_EQ(std::to_string(zero - INTMAX_MIN), "9223372036854775808");
 }
 
 TEST(Integer, Multiplication) {
@@ -216,6 +294,52 @@ TEST(Integer, Multiplication) {
   EXPECT_EQ(std::to_string(two * negativeOne), "-2");
 }
 
+TEST(Integer, Multiplication_Int) {
+  constexpr intmax_t max = std::numeric_limits<intmax_t>::max();
+  constexpr intmax_t min = std::numeric_limits<intmax_t>::min();
+
+  EXPECT_EQ(std::to_string(Integer{0} * -5), "0");
+  EXPECT_EQ(std::to_string(Integer{7} * 0), "0");
+  EXPECT_EQ(std::to_string(Integer{7} * -1), "-7");
+  EXPECT_EQ(std::to_string(Integer{-7} * -6), "42");
+  EXPECT_EQ(std::to_string(Integer{"4294967295"} * 4294967295), "18446744065119617025");
+  EXPECT_EQ(std::to_string(Integer{"4294967296"} * 4294967296), "18446744073709551616");
+  EXPECT_EQ(std::to_string(Integer{3} * max), "27670116110564327421");
+  EXPECT_EQ(std::to_string(Integer{-3} * min), "27670116110564327424");
+  EXPECT_EQ(std::to_string(Integer{"-18446744073709551616"} * min), "170141183460469231731687303715884105728");
+
+  Integer value{-2};
+  value *= 1000000007;
+  EXPECT_EQ(std::to_string(value), "-2000000014");
+  value *= -10000000000;
+  EXPECT_EQ(std::to_string(value), "20000000140000000000");
+}
+
+TEST(Integer, Multiplication_Big) {
+  Integer sliceMax{999999999};
+  Integer absurdIntegerOne{"1354645611354413541715318441313195"};
+  Integer absurdIntegerTwo{"137415147537554114372745478463741"};
+  Integer negativeAbsurdIntegerTwo{"-137415147537554114372745478463741"};
+
+  EXPECT_EQ(std::to_string(sliceMax * sliceMax), "999999998000000001");
+  EXPECT_EQ(std::to_string(Integer{"12345678901234567890"} * Integer{"98765432109876543210"}),
+            "1219326311370217952237463801111263526900");
+  EXPECT_EQ(std::to_string(absurdIntegerOne * absurdIntegerTwo),
+            "186148826545366927834149253724351422384096937312335307275232362495");
+  EXPECT_EQ(std::to_string(absurdIntegerOne * negativeAbsurdIntegerTwo),
+            "-186148826545366927834149253724351422384096937312335307275232362495");
+
+  // Long enough to need more than one carry pass
+  Integer nines{std::string(400, '9')};
+  EXPECT_EQ(std::to_string(nines * nines), std::string(399, '9') + "8" + std::string(399, '0') + "1");
+
+  // Long enough to go through Karatsuba
+  Integer moreNines{std::string(3000, '9')};
+  EXPECT_EQ(std::to_string(moreNines * nines),
+            std::string(399, '9') + "8" + std::string(2600, '9') + std::string(399, '0') + "1");
+  EXPECT_EQ(std::to_string(moreNines * moreNines), std::string(2999, '9') + "8" + std::string(2999, '0') + "1");
+}
+
 TEST(Integer, Division) {
   Integer negativeOne{-1};
   Integer one{1};
@@ -235,6 +359,29 @@ TEST(Integer, Division) {
   EXPECT_EQ(std::to_string(thousandTwentyFour / sixteen), "64");
   EXPECT_EQ(std::to_string(bigInteger / sixteen), "512");
   EXPECT_EQ(std::to_string(two / negativeOne), "-2");
+
+  EXPECT_EQ(std::to_string(one / two), "0");
+  EXPECT_EQ(std::to_string(five / ten), "0");
+  EXPECT_EQ(std::to_string(negativeOne / five), "0");
+}
+
+TEST(Integer, Division_Big) {
+  Integer absurdProduct{"186148826545366927834149253724351422384096937312335307275232374840"};
+  Integer absurdIntegerOne{"1354645611354413541715318441313195"};
+  Integer absurdIntegerTwo{"137415147537554114372745478463741"};
+
+  EXPECT_EQ(std::to_string(absurdProduct / absurdIntegerTwo), "1354645611354413541715318441313195");
+  EXPECT_EQ(std::to_string(absurdProduct / absurdIntegerOne), "137415147537554114372745478463741");
+  EXPECT_EQ(std::to_string(absurdIntegerTwo / absurdProduct), "0");
+  EXPECT_EQ(std::to_string(Integer{"100000000000000000000000000000000000000000000000007"} /
+                           Integer{"100000000000000000003"}),
+            "999999999999999999970000000000");
+  EXPECT_EQ(std::to_string(Integer{"1606938044258990275541962092341162602522202993782792835301376"} /
+                           Integer{"42391158275216203514294433201"}),
+            "37907387050532168202330577830736");
+  EXPECT_EQ(std::to_string(Integer{"-1606938044258990275541962092341162602522202993782792835301376"} /
+                           Integer{"42391158275216203514294433201"}),
+            "-37907387050532168202330577830736");
 }
 
 TEST(Integer, Modulo) {
@@ -256,6 +403,115 @@ TEST(Integer, Modulo) {
   EXPECT_EQ(std::to_string(fiftyTwo % fiftyTwo), "0");
 
   EXPECT_EQ(std::to_string(negativeFifty % five), "0");
+  EXPECT_EQ(std::to_string(negativeFifty % fiftyTwo), "-50");
+  EXPECT_EQ(std::to_string(Integer{-7} % Integer{2}), "-1");
+  EXPECT_EQ(std::to_string(Integer{7} % Integer{-2}), "1");
+}
+
+TEST(Integer, Modulo_Big) {
+  Integer absurdProduct{"186148826545366927834149253724351422384096937312335307275232374840"};
+  Integer absurdIntegerTwo{"137415147537554114372745478463741"};
+
+  EXPECT_EQ(std::to_string(absurdProduct % absurdIntegerTwo), "12345");
+  EXPECT_EQ(std::to_string(absurdIntegerTwo % absurdProduct), "137415147537554114372745478463741");
+  EXPECT_EQ(std::to_string(Integer{"100000000000000000000000000000000000000000000000007"} %
+                           Integer{"100000000000000000003"}),
+            "90000000007");
+  EXPECT_EQ(std::to_string(Integer{"1606938044258990275541962092341162602522202993782792835301376"} %
+                           Integer{"42391158275216203514294433201"}),
+            "9597827864765685605598635440");
+}
+
+TEST(Integer, DivMod) {
+  auto [quotient, remainder] = Integer{"186148826545366927834149253724351422384096937312335307275232374840"}.divmod(
+      Integer{"137415147537554114372745478463741"});
+  EXPECT_EQ(std::to_string(quotient), "1354645611354413541715318441313195");
+  EXPECT_EQ(std::to_string(remainder), "12345");
+
+  for (auto [dividend, divisor, expectedQuotient, expectedRemainder] :
+       {std::tuple{7, 2, 3, 1}, {-7, 2, -3, -1}, {7, -2, -3, 1}, {-7, -2, 3, -1}, {6, -3, -2, 0}, {2, 7, 0, 2}}) {
+    auto [q, r] = Integer{dividend}.divmod(Integer{divisor});
+    EXPECT_EQ(q, expectedQuotient) << dividend << " / " << divisor;
+    EXPECT_EQ(r, expectedRemainder) << dividend << " % " << divisor;
+  }
+}
+
+TEST(Integer, DivModInPlace) {
+  Integer value{"1606938044258990275541962092341162602522202993782792835301376"};
+  auto quotient = value.divmodInPlace(Integer{"42391158275216203514294433201"});
+  EXPECT_EQ(std::to_string(quotient), "37907387050532168202330577830736");
+  EXPECT_EQ(std::to_string(value), "9597827864765685605598635440");
+
+  Integer negative{-12};
+  quotient = negative.divmodInPlace(Integer{4});
+  EXPECT_EQ(std::to_string(quotient), "-3");
+  EXPECT_EQ(std::to_string(negative), "0");
+  EXPECT_TRUE(negative.positive());
+
+  Integer small{3};
+  quotient = small.divmodInPlace(Integer{-4});
+  EXPECT_EQ(std::to_string(quotient), "0");
+  EXPECT_EQ(std::to_string(small), "3");
+}
+
+TEST(Integer, CompoundAssignment) {
+  Integer value{5};
+
+  value += Integer{-8};
+  EXPECT_EQ(std::to_string(value), "-3");
+  value -= Integer{-3};
+  EXPECT_EQ(std::to_string(value), "0");
+  value -= Integer{"18446744073709551616"};
+  EXPECT_EQ(std::to_string(value), "-18446744073709551616");
+  value += Integer{"18446744073709551617"};
+  EXPECT_EQ(std::to_string(value), "1");
+
+  value *= Integer{"-4294967297"};
+  EXPECT_EQ(std::to_string(value), "-4294967297");
+  value *= value;
+  EXPECT_EQ(std::to_string(value), "18446744082299486209");
+  value += value;
+  EXPECT_EQ(std::to_string(value), "36893488164598972418");
+  value -= value;
+  EXPECT_EQ(std::to_string(value), "0");
+
+  value = Integer{"340282366920938463463374607431768211456"}; // 2^128
+  value /= Integer{-4294967296};
+  EXPECT_EQ(std::to_string(value), "-79228162514264337593543950336");
+  value /= Integer{"18446744073709551616"};
+  EXPECT_EQ(std::to_string(value), "-4294967296");
+  value %= Integer{1000};
+  EXPECT_EQ(std::to_string(value), "-296");
+
+  value += 300;
+  EXPECT_EQ(std::to_string(value), "4");
+  value -= 10;
+  EXPECT_EQ(std::to_string(value), "-6");
+  value *= -7;
+  EXPECT_EQ(std::to_string(value), "42");
+  value -= std::numeric_limits<intmax_t>::min();
+  EXPECT_EQ(std::to_string(value), "9223372036854775850");
+}
+
+TEST(Integer, TemporaryOperands) {
+  Integer a{"123456789012345678901234567890"};
+  Integer b{-987654321};
+  Integer c{42};
+
+  EXPECT_EQ(std::to_string(a * b + c), "-121932631124828532112482853211126352648");
+  EXPECT_EQ(std::to_string(c + a * b), "-121932631124828532112482853211126352648");
+  EXPECT_EQ(std::to_string(a * b - c), "-121932631124828532112482853211126352732");
+  EXPECT_EQ(std::to_string(c - a * b), "121932631124828532112482853211126352732");
+  EXPECT_EQ(std::to_string(a * b * c), "-5121170507242798348724279834867306812980");
+  EXPECT_EQ(std::to_string(c * (a - c)), "5185185138518518513851851849616");
+  EXPECT_EQ(std::to_string((a + c) - (a - c)), "84");
+  EXPECT_EQ(std::to_string(b * 2 + 1), "-1975308641");
+  EXPECT_EQ(std::to_string((b - 1) * -2), "1975308644");
+
+  // These take the slices over, instead of copying them
+  EXPECT_EQ(std::to_string(-(a * b)), "121932631124828532112482853211126352690");
+  EXPECT_EQ(std::to_string((a * b).absolute()), "121932631124828532112482853211126352690");
+  EXPECT_EQ(std::to_string(std::abs(b * 2)), "1975308642");
 }
 
 TEST(Integer, Power) {
@@ -281,6 +537,28 @@ TEST(Integer, Power) {
   EXPECT_EQ(std::to_string(std::pow(negativeFour, one)), "-4");
   EXPECT_EQ(std::to_string(std::pow(negativeFour, two)), "16");
   EXPECT_EQ(std::to_string(std::pow(negativeFour, three)), "-64");
+
+  EXPECT_EQ(std::to_string(std::pow(two, Integer{1000})),
+            "1071508607186267320948425049060001810561404811705533607443750388370351051124936122493198378815695858"
+            "1275946729175531468251871452856923140435984577574698574803934567774824230985421074605062371141877954"
+            "1821530464749835819412673987675591655439460770629145711964776865421676604298316526243868372056680693"
+            "76");
+}
+
+TEST(Integer, PowMod) {
+  EXPECT_EQ(std::to_string(Integer{3}.powMod(Integer{0}, Integer{7})), "1");
+  EXPECT_EQ(std::to_string(Integer{3}.powMod(Integer{5}, Integer{1})), "0");
+  EXPECT_EQ(std::to_string(Integer{-7}.powMod(Integer{13}, Integer{10})), "3");
+  EXPECT_EQ(std::to_string(Integer{-7}.powMod(Integer{13}, Integer{-10})), "3");
+
+  Integer bigExponent{"100000000000000000007"};
+  Integer bigModulus{"1000000000000000000000000000057"};
+  EXPECT_EQ(std::to_string(Integer{3}.powMod(bigExponent, bigModulus)), "833722544651502183370455795997");
+
+  Integer mersennePrime{"170141183460469231731687303715884105727"};
+  EXPECT_EQ(std::to_string(Integer{123456789}.powMod(Integer{65537}, mersennePrime)),
+            "142853123101158166119999597599049700840");
+  EXPECT_EQ(std::to_string(Integer{2}.powMod(Integer{"18446744073709551629"}, Integer{1000000007})), "399990345");
 }
 
 TEST(Integer, Comparison_EqualTo) {
@@ -441,6 +719,79 @@ TEST(Integer, Comparison_GreaterThanOrEqualTo) {
   EXPECT_FALSE(Integer{-500} >= Integer{-499});
 }
 
+TEST(Integer, Comparison_GreaterThanOrEqualToInt) {
+  EXPECT_TRUE(Integer{1} >= 0);
+  EXPECT_TRUE(Integer{-499} >= -500);
+  EXPECT_TRUE(Integer{-500} >= -500);
+
+  EXPECT_FALSE(Integer{9} >= 10);
+  EXPECT_FALSE(Integer{-500} >= -499);
+}
+
+TEST(Integer, Comparison_Int_Big) {
+  constexpr intmax_t max = std::numeric_limits<intmax_t>::max();
+  constexpr intmax_t min = std::numeric_limits<intmax_t>::min();
+  Integer huge{"18446744073709551616"};
+  Integer negativeHuge{"-18446744073709551616"};
+
+  EXPECT_TRUE(Integer{max} == max);
+  EXPECT_TRUE(Integer{min} == min);
+  EXPECT_TRUE(Integer{"4294967296"} == 4294967296);
+  EXPECT_FALSE(Integer{"4294967297"} == 4294967296);
+  EXPECT_FALSE(Integer{min} == max);
+
+  EXPECT_TRUE(huge > max);
+  EXPECT_TRUE(negativeHuge < min);
+  EXPECT_TRUE(Integer{max} + 1 > max);
+  EXPECT_TRUE(Integer{min} - 1 < min);
+  EXPECT_TRUE(Integer{min} <= min);
+  EXPECT_TRUE(Integer{"-4294967296"} < -4294967295);
+  EXPECT_FALSE(Integer{"-4294967296"} > -4294967295);
+}
+
+TEST(Integer, Literals) {
+  EXPECT_EQ(0_Z, 0);
+  EXPECT_EQ(42_Z, 42);
+  EXPECT_EQ(-42_Z, -42);
+  EXPECT_EQ(0x2A_Z, 42);
+  EXPECT_EQ(0b101010_Z, 42);
+  EXPECT_EQ(052_Z, 42);
+  EXPECT_EQ(1'000'000_Z, 1000000);
+  EXPECT_EQ(123456789012345678901234567890_Z, Integer{"123456789012345678901234567890"});
+  EXPECT_EQ(0xFFFF'FFFF'FFFF'FFFF'FFFF'FFFF'FFFF'FFFF'FFFF'FFFF_Z,
+            Integer{"1461501637330902918203684832716283019655932542975"});
+  EXPECT_EQ(-98765432109876543210987654321098765432109876543210_Z,
+            Integer{"-98765432109876543210987654321098765432109876543210"});
+}
+
+#if defined(__cpp_constexpr_dynamic_alloc) && defined(__cpp_lib_is_constant_evaluated)
+TEST(Integer, ConstantEvaluation) {
+  static_assert(Integer{5} + Integer{7} == 12);
+  static_assert(Integer{5} - 7 == -2);
+  static_assert(Integer{5} - INTMAX_MIN == Integer{INTMAX_MAX} + 6);
+  static_assert(Integer{-3} * 4 - 2 == -14);
+  static_assert(-(Integer{3} - Integer{3}) == 0);
+  static_assert(0xFFFF'FFFF'FFFF'FFFF_Z + 1 == 0x1'0000'0000'0000'0000_Z);
+  static_assert(0x1'0000'0000'0000'0000_Z - 1 == 0xFFFF'FFFF'FFFF'FFFF_Z);
+  static_assert(Integer{10}.power(Integer{30}) == 1'000'000'000'000'000'000'000'000'000'000_Z);
+  static_assert(Integer{-2}.power(Integer{3}) < Integer{-7});
+
+  // Anything that outgrows the inline slices has to be gone by the end of the evaluation, but it can still be used
+  static_assert(Integer{2}.power(Integer{300}) - Integer{2}.power(Integer{299}) * 2 == 0);
+  static_assert(Integer{3}.power(Integer{200}) > Integer{2}.power(Integer{316}));
+
+  constexpr auto factorial = [] {
+    Integer result{1};
+    for (intmax_t i = 2; i <= 30; ++i) {
+      result *= i;
+    }
+    return result;
+  }();
+  EXPECT_EQ(factorial, Integer{"265252859812191058636308480000000"});
+  EXPECT_EQ(factorial * factorial, 265252859812191058636308480000000_Z * 265252859812191058636308480000000_Z);
+}
+#endif
+
 TEST(Integer, Increment) {
   Integer value{-10};
   EXPECT_EQ(std::to_string(++value), "-9");
@@ -475,3 +826,69 @@ TEST(Integer, Increment) {
   EXPECT_EQ(std::to_string(++bigNegative), "-1000000000");
   EXPECT_EQ(std::to_string(++bigNegative), "-999999999");
 }
+
+TEST(Integer, BitQueries) {
+  EXPECT_EQ(Integer{0}.bitLength(), 0);
+  EXPECT_EQ(Integer{1}.bitLength(), 1);
+  EXPECT_EQ(Integer{-255}.bitLength(), 8);
+  EXPECT_EQ(Integer{"4294967296"}.bitLength(), 33);
+  EXPECT_EQ(Integer{"123456789012345678901234567890"}.bitLength(), 97);
+
+  EXPECT_EQ(Integer{1}.countTrailingZeros(), 0);
+  EXPECT_EQ(Integer{-40}.countTrailingZeros(), 3);
+  EXPECT_EQ(Integer{"18446744073709551616"}.countTrailingZeros(), 64);
+
+  EXPECT_EQ(Integer{0}.popCount(), 0);
+  EXPECT_EQ(Integer{-7}.popCount(), 3);
+  EXPECT_EQ(Integer{"123456789012345678901234567890"}.popCount(), 54);
+}
+
+TEST(Integer, Shifts) {
+  Integer big{"123456789012345678901234567890"};
+
+  EXPECT_EQ(Integer{0} << 100, 0);
+  EXPECT_EQ(Integer{3} << 1, 6);
+  EXPECT_EQ(Integer{-3} << 32, -12884901888);
+  EXPECT_EQ(big << 100, Integer{"156500072693749876333549759454926973536814597484617284976640"});
+
+  EXPECT_EQ(Integer{6} >> 1, 3);
+  EXPECT_EQ(Integer{7} >> 64, 0);
+  EXPECT_EQ(big >> 70, 104571967);
+  EXPECT_EQ(big << 100 >> 100, big);
+
+  // Rounding towards negative infinity
+  EXPECT_EQ(Integer{-6} >> 1, -3);
+  EXPECT_EQ(Integer{-5} >> 1, -3);
+  EXPECT_EQ(Integer{-1} >> 100, -1);
+  EXPECT_EQ(Integer{-4294967296} >> 32, -1);
+  EXPECT_EQ(big * -1 >> 70, -104571968);
+
+  Integer value{5};
+  value <<= 40;
+  EXPECT_EQ(value, 5497558138880);
+  value >>= 39;
+  EXPECT_EQ(value, 10);
+}
+
+TEST(Integer, BitwiseOperators) {
+  EXPECT_EQ(Integer{12} & Integer{10}, 8);
+  EXPECT_EQ(Integer{12} | Integer{10}, 14);
+  EXPECT_EQ(Integer{12} ^ Integer{10}, 6);
+
+  // Negative numbers act like they're in two's complement
+  EXPECT_EQ(Integer{-12} & Integer{10}, 0);
+  EXPECT_EQ(Integer{-12} | Integer{10}, -2);
+  EXPECT_EQ(Integer{-12} ^ Integer{-10}, 2);
+  EXPECT_EQ(Integer{-1} & Integer{"18446744073709551617"}, Integer{"18446744073709551617"});
+
+  Integer left{"123456789012345678901234567890"};
+  Integer right{"-98765432109876543210987654321"};
+  EXPECT_EQ(left & right, Integer{"39857104640305249140344357442"});
+  EXPECT_EQ(left | right, Integer{"-15165747737836113450097443873"});
+  EXPECT_EQ(left ^ right, Integer{"-55022852378141362590441801315"});
+  EXPECT_EQ(left * -1 & right, Integer{"-138622536750181792351332011762"});
+
+  auto value = left << 100;
+  value &= (Integer{1} << 130) - 1;
+  EXPECT_EQ(value, Integer{"302984417681386893975453667670529933312"});
+}
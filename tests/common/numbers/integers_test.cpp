@@ -24,6 +24,9 @@
 
 #include <gtest/gtest.h>
 
+#include <utility> // std::move, std::pair
+#include <vector>  // std::vector
+
 using namespace pzl;
 
 TEST(Integers, GreatestCommonDivisor) {
@@ -31,6 +34,174 @@ TEST(Integers, GreatestCommonDivisor) {
   EXPECT_EQ(greatestCommonDivisor(Integer{17}, Integer{19}), Integer{1});
   EXPECT_EQ(greatestCommonDivisor(Integer{10}, Integer{25}), Integer{5});
   EXPECT_EQ(greatestCommonDivisor(Integer{3154}, Integer{4522}), Integer{38});
+
+  EXPECT_EQ(greatestCommonDivisor(Integer{0}, Integer{0}), 0);
+  EXPECT_EQ(greatestCommonDivisor(Integer{0}, Integer{-5}), 5);
+  EXPECT_EQ(greatestCommonDivisor(Integer{-12}, Integer{18}), 6);
+  EXPECT_EQ(greatestCommonDivisor(Integer{3298534883328}, Integer{309237645312}), 103079215104); // 3 * 2^35
+}
+
+TEST(Integers, GreatestCommonDivisor_Big) {
+  Integer left{"1076844420158179363538033264907183564994268918956835978067040025619855531118732440646062667508496089"
+               "504662107060637690988106225279901398"};
+  Integer right{"81973328387742109068495862553810256567489411211199777098242103811604243284008000157243161729204338"
+                "8135029638871092897233120254995"};
+  Integer expected{"3404814346783443683535942156233764334611952847"};
+  EXPECT_EQ(greatestCommonDivisor(left, right), expected);
+  EXPECT_EQ(greatestCommonDivisor(right, left * -1), expected);
+
+  // Consecutive Fibonacci numbers take the most steps
+  Integer fibonacci300{"222232244629420445529739893461909967206666939096499764990979600"};
+  Integer fibonacci299{"137347080577163115432025771710279131845700275212767467264610201"};
+  EXPECT_EQ(greatestCommonDivisor(fibonacci300, fibonacci299), 1);
+  EXPECT_EQ(greatestCommonDivisor(fibonacci300 * 7, fibonacci299 * 7), 7);
+}
+
+TEST(Integers, ExtendedGreatestCommonDivisor) {
+  std::vector<std::pair<Integer, Integer>> inputs{
+      {Integer{240}, Integer{46}},
+      {Integer{-240}, Integer{46}},
+      {Integer{17}, Integer{-5}},
+      {Integer{0}, Integer{-7}},
+      {Integer{7}, Integer{0}},
+      {Integer{"222232244629420445529739893461909967206666939096499764990979600"},
+       Integer{"137347080577163115432025771710279131845700275212767467264610201"}},
+      {Integer{"1076844420158179363538033264907183564994268918956835978067040025619855531118732440646062667508496"},
+       Integer{"-3404814346783443683535942156233764334611952847"}},
+  };
+
+  for (const auto &[left, right] : inputs) {
+    auto [gcd, x, y] = extendedGreatestCommonDivisor(left, right);
+    EXPECT_EQ(gcd, greatestCommonDivisor(left, right)) << left.toString() << ", " << right.toString();
+    EXPECT_EQ(left * x + right * y, gcd) << left.toString() << ", " << right.toString();
+  }
+}
+
+TEST(Integers, SquareRoot) {
+  EXPECT_EQ(squareRoot(Integer{0}), 0);
+  EXPECT_EQ(squareRoot(Integer{1}), 1);
+  EXPECT_EQ(squareRoot(Integer{8}), 2);
+  EXPECT_EQ(squareRoot(Integer{9}), 3);
+  EXPECT_EQ(squareRoot(Integer{"18446744073709551615"}), Integer{4294967295});
+  EXPECT_EQ(squareRoot(Integer{"340282366920938463463374607431768211455"}), Integer{"18446744073709551615"});
+  EXPECT_EQ(squareRoot(Integer{"340282366920938463463374607431768211456"}), Integer{"18446744073709551616"});
+
+  Integer big{"1234567890123456789012345678901234567890123456789012345678901234567890"
+              "12345678901234567890123456789012345678901234567890"};
+  EXPECT_EQ(squareRoot(big), Integer{"351364182882014425311122238169988293917484087723940033681654"});
+}
+
+TEST(Integers, NthRoot) {
+  EXPECT_EQ(nthRoot(Integer{0}, 3), 0);
+  EXPECT_EQ(nthRoot(Integer{26}, 3), 2);
+  EXPECT_EQ(nthRoot(Integer{27}, 3), 3);
+  EXPECT_EQ(nthRoot(Integer{-27}, 3), -3);
+  EXPECT_EQ(nthRoot(Integer{-28}, 3), -3);
+  EXPECT_EQ(nthRoot(Integer{1000}, 1), 1000);
+  EXPECT_EQ(nthRoot(Integer{1000}, 100), 1);
+
+  Integer big{"1234567890123456789012345678901234567890123456789012345678901234567890"
+              "12345678901234567890123456789012345678901234567890"};
+  EXPECT_EQ(nthRoot(big, 2), squareRoot(big));
+  EXPECT_EQ(nthRoot(big, 3), Integer{"4979338592347722697109915038833684538584"});
+  EXPECT_EQ(nthRoot(big, 7), Integer{103056067952212410});
+  EXPECT_EQ(nthRoot(big, 50), 240);
+}
+
+TEST(Integers, IsPerfectSquare) {
+  EXPECT_TRUE(isPerfectSquare(Integer{0}));
+  EXPECT_TRUE(isPerfectSquare(Integer{1}));
+  EXPECT_TRUE(isPerfectSquare(Integer{144}));
+  EXPECT_FALSE(isPerfectSquare(Integer{-4}));
+  EXPECT_FALSE(isPerfectSquare(Integer{2}));
+  EXPECT_FALSE(isPerfectSquare(Integer{145}));
+
+  Integer root{"351364182882014425311122238169988293917484087723940033681654"};
+  EXPECT_TRUE(isPerfectSquare(root * root));
+  EXPECT_FALSE(isPerfectSquare(root * root + 1));
+  EXPECT_FALSE(isPerfectSquare(root * root - 1));
+  EXPECT_FALSE(isPerfectSquare(root * (root + 2)));
+}
+
+TEST(Integers, IsPrime) {
+  auto byTrialDivision = [](intmax_t n) {
+    if (n < 2) return false;
+    for (intmax_t i = 2; i * i <= n; ++i) {
+      if (n % i == 0) return false;
+    }
+    return true;
+  };
+  for (intmax_t i = -5; i < 20000; ++i) {
+    EXPECT_EQ(isPrime(Integer{i}), byTrialDivision(i)) << i;
+  }
+
+  // Carmichael numbers, strong pseudoprimes to base 2 and strong Lucas pseudoprimes
+  std::vector<intmax_t> composites{561, 41041, 825265, 2047, 3277, 4033, 3215031751, 5459, 5777, 10877, 16109, 18971};
+  for (auto composite : composites) {
+    EXPECT_FALSE(isPrime(Integer{composite})) << composite;
+  }
+  EXPECT_FALSE(isPrime(Integer{3825123056546413051}));
+
+  // Strong pseudoprimes to base 2 with no factors below 1000, so it's up to the Lucas test to catch them
+  EXPECT_FALSE(isPrime(Integer{1069 * 2137}));
+  EXPECT_FALSE(isPrime(Integer{1657 * 3313}));
+  EXPECT_FALSE(isPrime(Integer{2089 * 4177}));
+
+  auto mersenne = [](size_t exponent) { return (Integer{1} << exponent) - 1; };
+  EXPECT_TRUE(isPrime(mersenne(61)));
+  EXPECT_TRUE(isPrime(mersenne(89)));
+  EXPECT_TRUE(isPrime(mersenne(127)));
+  EXPECT_TRUE(isPrime(mersenne(521)));
+  EXPECT_FALSE(isPrime(mersenne(67)));
+  EXPECT_FALSE(isPrime(mersenne(523)));
+  EXPECT_FALSE(isPrime(mersenne(89) * mersenne(127)));
+  EXPECT_FALSE(isPrime(mersenne(127) * mersenne(127)));
+}
+
+TEST(Integers, NextPrime) {
+  EXPECT_EQ(nextPrime(Integer{-10}), 2);
+  EXPECT_EQ(nextPrime(Integer{2}), 3);
+  EXPECT_EQ(nextPrime(Integer{3}), 5);
+  EXPECT_EQ(nextPrime(Integer{997}), 1009);
+  EXPECT_EQ(nextPrime(Integer{1000000000000000000}), 1000000000000000003);
+
+  auto powerOfTwo = [](size_t exponent) { return Integer{1} << exponent; };
+  EXPECT_EQ(nextPrime(powerOfTwo(64)), powerOfTwo(64) + 13);
+  EXPECT_EQ(nextPrime(powerOfTwo(128)), powerOfTwo(128) + 51);
+  EXPECT_EQ(nextPrime(powerOfTwo(200)), powerOfTwo(200) + 235);
+}
+
+TEST(Integers, Factorial) {
+  Integer expected{1};
+  for (size_t n = 0; n <= 1000; ++n) {
+    if (n > 0) expected *= static_cast<intmax_t>(n);
+    EXPECT_EQ(factorial(n), expected) << n;
+  }
+
+  EXPECT_EQ(factorial(25).toString(), "15511210043330985984000000");
+}
+
+TEST(Integers, Binomial) {
+  // Pascal's triangle goes through both of the ways binomial works things out
+  std::vector<Integer> row{Integer{1}};
+  for (size_t n = 1; n <= 300; ++n) {
+    std::vector<Integer> next{Integer{1}};
+    for (size_t k = 1; k < n; ++k) {
+      next.push_back(row[k - 1] + row[k]);
+    }
+    next.emplace_back(1);
+    row = std::move(next);
+
+    for (size_t k = 0; k <= n; ++k) {
+      EXPECT_EQ(binomial(n, k), row[k]) << n << " choose " << k;
+    }
+  }
+
+  EXPECT_EQ(binomial(5, 6), 0);
+  EXPECT_EQ(binomial(0, 0), 1);
+  EXPECT_EQ(binomial(100, 50).toString(), "100891344545564193334812497256");
+  EXPECT_EQ(binomial(1000000000, 3).toString(), "166666666166666667000000000");
+  EXPECT_EQ(binomial(2000, 1000), factorial(2000) / (factorial(1000) * factorial(1000)));
 }
 
 TEST(Integers, LowestCommonMultiple) {
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026 Emanuel Machado da Silva
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "common/numbers/montgomery.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+
+using namespace pzl;
+
+namespace {
+
+// Checks every operation against plain Integer arithmetic, for a bunch of random values below the modulus
+template <typename Context>
+void expectSameAsIntegers(const Integer &modulus) {
+  Context context{modulus};
+  std::mt19937_64 engine{modulus.bitLength()};
+
+  auto randomBelowModulus = [&engine, &modulus]() {
+    std::string digits;
+    for (auto i = 0; i < 45; ++i) {
+      digits += static_cast<char>('0' + engine() % 10);
+    }
+    return Integer{digits} % modulus;
+  };
+
+  for (auto i = 0; i < 50; ++i) {
+    auto left = randomBelowModulus();
+    auto right = randomBelowModulus();
+    auto montgomeryLeft = context.toMontgomery(left);
+    auto montgomeryRight = context.toMontgomery(right);
+
+    EXPECT_EQ(context.fromMontgomery(montgomeryLeft), left);
+    EXPECT_EQ(context.fromMontgomery(context.add(montgomeryLeft, montgomeryRight)), (left + right) % modulus);
+    EXPECT_EQ(context.fromMontgomery(context.subtract(montgomeryLeft, montgomeryRight)),
+              (left - right + modulus) % modulus);
+    EXPECT_EQ(context.fromMontgomery(context.multiply(montgomeryLeft, montgomeryRight)), left * right % modulus);
+  }
+}
+}
+
+TEST(Montgomery, SameAsIntegers) {
+  expectSameAsIntegers<MontgomeryContext>(Integer{3});
+  expectSameAsIntegers<MontgomeryContext>(Integer{1000000007});
+  expectSameAsIntegers<MontgomeryContext>(Integer{"170141183460469231731687303715884105727"});
+  expectSameAsIntegers<MontgomeryContext>(Integer{"1111111111111111111111111111111111111111111111111111111111111"});
+
+  expectSameAsIntegers<MontgomeryContext64>(Integer{1000000007});
+  expectSameAsIntegers<MontgomeryContext64>(Integer{"18446744073709551557"});
+
+  expectSameAsIntegers<MontgomeryContext128>(Integer{1000000007});
+  expectSameAsIntegers<MontgomeryContext128>(Integer{"170141183460469231731687303715884105727"});
+}
+
+TEST(Montgomery, Conversions) {
+  MontgomeryContext64 context{Integer{101}};
+
+  EXPECT_EQ(context.fromMontgomery(context.toMontgomery(Integer{0})), 0);
+  EXPECT_EQ(context.fromMontgomery(context.toMontgomery(Integer{1})), 1);
+  EXPECT_EQ(context.fromMontgomery(context.toMontgomery(Integer{205})), 3);
+  EXPECT_EQ(context.fromMontgomery(context.toMontgomery(Integer{-1})), 100);
+  EXPECT_EQ(context.toMontgomery(Integer{1}), context.one());
+  EXPECT_EQ(context.toMontgomery(Integer{-2}), context.toMontgomery(Integer{99}));
+}
+
+TEST(Montgomery, PowMod) {
+  Integer mersenne61{"2305843009213693951"};
+  Integer mersenne127{"170141183460469231731687303715884105727"};
+  Integer repunit{"1111111111111111111111111111111111111111111111111111111111111"};
+
+  EXPECT_EQ(MontgomeryContext64{mersenne61}.powMod(Integer{3}, Integer{"1000000000000000000"}),
+            Integer{"1990325404628017161"});
+  EXPECT_EQ(MontgomeryContext128{mersenne127}.powMod(Integer{5}, mersenne127 - 1), 1);
+  EXPECT_EQ(MontgomeryContext{mersenne127}.powMod(Integer{123456789}, (Integer{1} << 100) + 7),
+            Integer{"163991431541352018676885945341866780796"});
+  EXPECT_EQ(MontgomeryContext{repunit}.powMod(Integer{2}, repunit),
+            Integer{"222135180874549850516793149523888336952971997086704752894638"});
+
+  MontgomeryContext context{Integer{7}};
+  EXPECT_EQ(context.powMod(Integer{3}, Integer{0}), 1);
+  EXPECT_EQ(context.powMod(Integer{-3}, Integer{3}), 1); // -27 % 7 == 1
+}
+
+TEST(Montgomery, Fits) {
+  Integer threeSlices{"18446744073709551629"}; // 2^64 + 13
+  EXPECT_TRUE(MontgomeryContext64::fits(Integer{"18446744073709551557"}));
+  EXPECT_FALSE(MontgomeryContext64::fits(threeSlices));
+  EXPECT_TRUE(MontgomeryContext128::fits(threeSlices));
+  EXPECT_FALSE(MontgomeryContext128::fits(Integer{1} << 128));
+  EXPECT_TRUE(MontgomeryContext::fits(Integer{1} << 1000));
+
+  // That's a hard failure in every build type, rather than a write past the end of the std::array
+  EXPECT_DEATH(MontgomeryContext64{threeSlices}, "");
+}
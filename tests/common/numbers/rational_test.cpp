@@ -24,6 +24,9 @@
 
 #include <gtest/gtest.h>
 
+#include <set>
+
+using pzl::Integer;
 using pzl::Rational;
 
 TEST(Numbers_Rational, CreateFromString) {
@@ -43,6 +46,12 @@ TEST(Numbers_Rational, CreateFromInt) {
   EXPECT_EQ(std::to_string(Rational(1)), "1");
 }
 
+TEST(Numbers_Rational, CreateFromIntegers) {
+  EXPECT_EQ(std::to_string(Rational(Integer{3}, Integer{4})), "3/4");
+  EXPECT_EQ(std::to_string(Rational(Integer{3}, Integer{-4})), "-3/4");
+  EXPECT_EQ(std::to_string(Rational(Integer{-3}, Integer{-4})), "3/4");
+}
+
 TEST(Numbers_Rational, Addition) {
   Rational negativeFive(-5);
   Rational negativeOne(-1);
@@ -228,6 +237,9 @@ TEST(Numbers_Rational, Power) {
   EXPECT_EQ(std::to_string(std::pow(negativeFour, one)), "-4");
   EXPECT_EQ(std::to_string(std::pow(negativeFour, two)), "16");
   EXPECT_EQ(std::to_string(std::pow(negativeFour, three)), "-64");
+
+  EXPECT_EQ(std::to_string(std::pow(Rational(2, 3), Rational(5))), "32/243");
+  EXPECT_EQ(std::to_string(std::pow(Rational(-4, 6), Rational(3))), "-8/27");
 }
 
 TEST(Numbers_Rational, Comparison_LessThan) {
@@ -248,6 +260,21 @@ TEST(Numbers_Rational, Comparison_LessThan) {
   EXPECT_FALSE(Rational(-500) < Rational(-500));
 }
 
+TEST(Numbers_Rational, Comparison_Fractions) {
+  EXPECT_TRUE(Rational(1, 3) < Rational(1, 2));
+  EXPECT_TRUE(Rational(-1, 2) < Rational(-1, 3));
+  EXPECT_TRUE(Rational(2, 3) <= Rational(2, 3));
+  EXPECT_TRUE(Rational(2, 4) <= Rational(1, 2));
+  EXPECT_TRUE(Rational(2, 4) >= Rational(1, 2));
+  EXPECT_TRUE(Rational(7, 5) > Rational(4, 3));
+  EXPECT_TRUE(Rational(7, 5) >= Rational(-7, 5));
+
+  EXPECT_FALSE(Rational(1, 2) < Rational(1, 3));
+  EXPECT_FALSE(Rational(2, 3) > Rational(2, 3));
+  EXPECT_FALSE(Rational(1, 3) >= Rational(1, 2));
+  EXPECT_FALSE(Rational(-1, 3) <= Rational(-1, 2));
+}
+
 TEST(Numbers_Rational, Comparison_EqualToRational) {
   EXPECT_TRUE(Rational(-1) == Rational(-1));
   EXPECT_TRUE(Rational(0) == Rational(0));
@@ -261,6 +288,14 @@ TEST(Numbers_Rational, Comparison_EqualToRational) {
   EXPECT_FALSE(Rational(1) == Rational(0));
 
   EXPECT_TRUE(Rational(1, -2) == Rational(-1, 2));
+
+  // Equality agrees with the ordering, even when the fractions aren't simplified
+  EXPECT_TRUE(Rational(2, 4) == Rational(1, 2));
+  EXPECT_TRUE(Rational(-3, 6) == Rational(1, -2));
+  EXPECT_TRUE(Rational(0, 5) == Rational(0));
+  EXPECT_FALSE(Rational(2, 4) != Rational(1, 2));
+  EXPECT_FALSE(Rational(2, 4) == Rational(2, 3));
+  EXPECT_EQ(std::set<Rational>{Rational(2, 4)}.count(Rational(1, 2)), 1);
 }
 
 TEST(Numbers_Rational, Comparison_EqualToInt) {
@@ -274,4 +309,10 @@ TEST(Numbers_Rational, Comparison_EqualToInt) {
   EXPECT_FALSE(Rational{0} == 1);
   EXPECT_FALSE(Rational{1} == -1);
   EXPECT_FALSE(Rational{1} == 0);
+
+  EXPECT_TRUE(Rational(4, 2) == 2);
+  EXPECT_TRUE(Rational(-6, 3) == -2);
+  EXPECT_TRUE(Rational(0, 7) == 0);
+  EXPECT_FALSE(Rational(3, 2) == 1);
+  EXPECT_TRUE(Rational(3, 2) != 1);
 }
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2021 Emanuel Machado da Silva
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "common/small_vector.h"
+
+#include <gtest/gtest.h>
+
+#include <utility> // std::move
+
+using Puzzles::SmallVector;
+
+TEST(SmallVector, ShouldStartEmptyAndInline) {
+  SmallVector<int, 2> values;
+
+  EXPECT_TRUE(values.empty());
+  EXPECT_TRUE(values.isInline());
+  EXPECT_EQ(values.capacity(), 2);
+}
+
+TEST(SmallVector, ShouldSpillToTheHeap) {
+  SmallVector<int, 2> values{1, 2};
+  EXPECT_TRUE(values.isInline());
+
+  values.push_back(3);
+  EXPECT_FALSE(values.isInline());
+  EXPECT_EQ(values.size(), 3);
+  EXPECT_EQ(values[0], 1);
+  EXPECT_EQ(values[1], 2);
+  EXPECT_EQ(values[2], 3);
+
+  values.pop_back();
+  EXPECT_EQ(values, (SmallVector<int, 2>{1, 2}));
+}
+
+TEST(SmallVector, Resize) {
+  SmallVector<int, 2> values{7};
+
+  values.resize(4);
+  EXPECT_EQ(values, (SmallVector<int, 2>{7, 0, 0, 0}));
+
+  values.resize(1);
+  values.resize(3, 5);
+  EXPECT_EQ(values, (SmallVector<int, 2>{7, 5, 5}));
+}
+
+TEST(SmallVector, CopyAndMove) {
+  SmallVector<int, 2> small{1};
+  SmallVector<int, 2> big{1, 2, 3};
+
+  auto smallCopy = small;
+  auto bigCopy = big;
+  EXPECT_EQ(smallCopy, small);
+  EXPECT_EQ(bigCopy, big);
+  EXPECT_NE(bigCopy.data(), big.data());
+
+  auto bigData = big.data();
+  auto moved = std::move(big);
+  EXPECT_EQ(moved.data(), bigData);
+  EXPECT_EQ(moved, bigCopy);
+
+  moved = std::move(small);
+  EXPECT_TRUE(moved.isInline());
+  EXPECT_EQ(moved, smallCopy);
+
+  moved = bigCopy;
+  EXPECT_EQ(moved, (SmallVector<int, 2>{1, 2, 3}));
+}
+
+#if defined(__cpp_constexpr_dynamic_alloc) && defined(__cpp_lib_is_constant_evaluated)
+TEST(SmallVector, ConstantEvaluation) {
+  constexpr auto sum = [] {
+    SmallVector<int, 2> values{1, 2};
+    values.push_back(3); // Onto the heap
+
+    auto moved = std::move(values);
+    values = SmallVector<int, 2>{4}; // Back inline
+
+    auto total = 0;
+    for (auto value : moved) {
+      total += value;
+    }
+    return total + values[0];
+  }();
+  static_assert(sum == 10);
+}
+#endif